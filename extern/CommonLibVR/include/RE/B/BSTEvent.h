@@ -38,21 +38,18 @@ namespace RE
 			}
 
 			BSSpinLockGuard locker(lock);
+			AddEventSink_Impl(a_eventSink);
+		}
 
-			if (notifying) {
-				if (std::find(pendingRegisters.begin(), pendingRegisters.end(), a_eventSink) == pendingRegisters.end()) {
-					pendingRegisters.push_back(a_eventSink);
-				}
-			} else {
-				if (std::find(sinks.begin(), sinks.end(), a_eventSink) == sinks.end()) {
-					sinks.push_back(a_eventSink);
+		/// Adds several event sinks under a single acquisition of the source's lock.
+		void AddEventSinks(std::span<Sink* const> a_eventSinks)
+		{
+			BSSpinLockGuard locker(lock);
+			for (const auto sink : a_eventSinks) {
+				if (sink) {
+					AddEventSink_Impl(sink);
 				}
 			}
-
-			auto it = std::find(pendingUnregisters.begin(), pendingUnregisters.end(), a_eventSink);
-			if (it != pendingUnregisters.end()) {
-				pendingUnregisters.erase(it);
-			}
 		}
 
 		template <class SinkEvent>
@@ -110,22 +107,18 @@ namespace RE
 			}
 
 			BSSpinLockGuard locker(lock);
+			RemoveEventSink_Impl(a_eventSink);
+		}
 
-			if (notifying) {
-				if (std::find(pendingUnregisters.begin(), pendingUnregisters.end(), a_eventSink) == pendingUnregisters.end()) {
-					pendingUnregisters.push_back(a_eventSink);
-				}
-			} else {
-				auto it = std::find(sinks.begin(), sinks.end(), a_eventSink);
-				if (it != sinks.end()) {
-					sinks.erase(it);
+		/// Removes several event sinks under a single acquisition of the source's lock.
+		void RemoveEventSinks(std::span<Sink* const> a_eventSinks)
+		{
+			BSSpinLockGuard locker(lock);
+			for (const auto sink : a_eventSinks) {
+				if (sink) {
+					RemoveEventSink_Impl(sink);
 				}
 			}
-
-			auto it = std::find(pendingRegisters.begin(), pendingRegisters.end(), a_eventSink);
-			if (it != pendingRegisters.end()) {
-				pendingRegisters.erase(it);
-			}
 		}
 
 		void SendEvent(const Event* a_event)
@@ -177,6 +170,44 @@ namespace RE
 		std::uint8_t       pad51;               // 51
 		std::uint16_t      pad52;               // 52
 		std::uint32_t      pad54;               // 54
+
+	private:
+		void AddEventSink_Impl(Sink* a_eventSink)
+		{
+			if (notifying) {
+				if (std::find(pendingRegisters.begin(), pendingRegisters.end(), a_eventSink) == pendingRegisters.end()) {
+					pendingRegisters.push_back(a_eventSink);
+				}
+			} else {
+				if (std::find(sinks.begin(), sinks.end(), a_eventSink) == sinks.end()) {
+					sinks.push_back(a_eventSink);
+				}
+			}
+
+			auto it = std::find(pendingUnregisters.begin(), pendingUnregisters.end(), a_eventSink);
+			if (it != pendingUnregisters.end()) {
+				pendingUnregisters.erase(it);
+			}
+		}
+
+		void RemoveEventSink_Impl(Sink* a_eventSink)
+		{
+			if (notifying) {
+				if (std::find(pendingUnregisters.begin(), pendingUnregisters.end(), a_eventSink) == pendingUnregisters.end()) {
+					pendingUnregisters.push_back(a_eventSink);
+				}
+			} else {
+				auto it = std::find(sinks.begin(), sinks.end(), a_eventSink);
+				if (it != sinks.end()) {
+					sinks.erase(it);
+				}
+			}
+
+			auto it = std::find(pendingRegisters.begin(), pendingRegisters.end(), a_eventSink);
+			if (it != pendingRegisters.end()) {
+				pendingRegisters.erase(it);
+			}
+		}
 	};
 	static_assert(sizeof(BSTEventSource<void*>) == 0x58);
 
@@ -188,4 +219,117 @@ namespace RE
 		virtual BSEventNotifyControl ProcessEvent(const Event* a_event, BSTEventSource<Event>* a_eventSource) = 0;  // 01
 	};
 	static_assert(sizeof(BSTEventSink<void>) == 0x8);
+
+	/// Owns the registration of one event sink with one event source.
+	///
+	/// The recorded source doubles as the registered flag, so asking to register with the
+	/// source the sink is already on returns immediately without taking the source's lock
+	/// or scanning its sink list. Registering with a different source moves the sink over.
+	/// The sink is unregistered when the ScopedSink is destroyed; call release() to keep the
+	/// registration instead, e.g. when the source may already be gone at that point.
+	template <class Event>
+	class ScopedSink
+	{
+	public:
+		using Sink = BSTEventSink<Event>;
+		using Source = BSTEventSource<Event>;
+
+		ScopedSink() noexcept = default;
+
+		explicit ScopedSink(Sink* a_sink) noexcept :
+			_sink(a_sink)
+		{}
+
+		ScopedSink(Sink* a_sink, Source* a_source) :
+			_sink(a_sink)
+		{
+			Register(a_source);
+		}
+
+		ScopedSink(const ScopedSink&) = delete;
+
+		ScopedSink(ScopedSink&& a_rhs) noexcept :
+			_sink(std::exchange(a_rhs._sink, nullptr)),
+			_source(std::exchange(a_rhs._source, nullptr))
+		{}
+
+		~ScopedSink() { Unregister(); }
+
+		ScopedSink& operator=(const ScopedSink&) = delete;
+
+		ScopedSink& operator=(ScopedSink&& a_rhs) noexcept
+		{
+			if (this != std::addressof(a_rhs)) {
+				Unregister();
+				_sink = std::exchange(a_rhs._sink, nullptr);
+				_source = std::exchange(a_rhs._source, nullptr);
+			}
+			return *this;
+		}
+
+		/// Returns true if this call added the sink, false if there is no sink or source or
+		/// the sink is already registered with a_source.
+		bool Register(Source* a_source)
+		{
+			if (!_sink || !a_source || _source == a_source) {
+				return false;
+			}
+
+			Unregister();
+			a_source->AddEventSink(_sink);
+			_source = a_source;
+			return true;
+		}
+
+		/// Returns true if the sink was registered and has now been removed.
+		bool Unregister()
+		{
+			if (!_source) {
+				return false;
+			}
+
+			std::exchange(_source, nullptr)->RemoveEventSink(_sink);
+			return true;
+		}
+
+		/// Forgets the registration without removing the sink from its source.
+		Source* release() noexcept { return std::exchange(_source, nullptr); }
+
+		/// Registers every listed sink with a_source that is not already on it, taking the
+		/// source's lock once for the lot. Returns the number of sinks added.
+		template <class... Scoped>
+		static std::size_t RegisterAll(Source* a_source, Scoped&... a_scoped)
+		{
+			static_assert((std::is_same_v<Scoped, ScopedSink> && ...));
+
+			if (!a_source) {
+				return 0;
+			}
+
+			std::array<ScopedSink*, sizeof...(Scoped)> entries{ std::addressof(a_scoped)... };
+			std::array<Sink*, sizeof...(Scoped)>       pending{};
+			std::size_t                                count = 0;
+			for (const auto entry : entries) {
+				if (entry->_sink && entry->_source != a_source) {
+					entry->Unregister();
+					entry->_source = a_source;
+					pending[count++] = entry->_sink;
+				}
+			}
+
+			if (count > 0) {
+				a_source->AddEventSinks({ pending.data(), count });
+			}
+			return count;
+		}
+
+		[[nodiscard]] Sink*   sink() const noexcept { return _sink; }
+		[[nodiscard]] Source* source() const noexcept { return _source; }
+		[[nodiscard]] bool    registered() const noexcept { return _source != nullptr; }
+
+	private:
+		// members
+		Sink*   _sink{ nullptr };    // 00
+		Source* _source{ nullptr };  // 08
+	};
 }
@@ -0,0 +1,93 @@
+#pragma once
+
+#include "RE/N/NiMatrix3.h"
+#include "RE/N/NiPoint3.h"
+
+namespace RE
+{
+	/// Batch versions of the NiPoint3 and NiMatrix3 operations, for code that transforms many
+	/// points or directions at once.
+	///
+	/// Each operation accepts points either as an array of NiPoint3 (AoS) or as separate x, y and z
+	/// arrays (SoA). The SoA form feeds the vector units directly; the AoS form is transposed in
+	/// small blocks on the way in and out, so prefer SoA for large hot loops. The work runs on
+	/// AVX2 or SSE4.1 when the CPU supports it and on a scalar fallback otherwise. All levels
+	/// evaluate the same expressions as the single-point functions, so results agree with them to
+	/// within rounding, except EulerAnglesToAxesZXY, which uses its own sin/cos approximation
+	/// (within 1e-7 of std::sin/std::cos for angles up to a few thousand radians).
+	///
+	/// Outputs may alias the matching input exactly but must not partially overlap it. Spans of
+	/// differing lengths are a precondition violation; only the shortest length is processed.
+	namespace NiBatch
+	{
+		enum class SimdLevel
+		{
+			kScalar,
+			kSSE41,
+			kAVX2
+		};
+
+		template <class T>
+		struct Point3Span
+		{
+			using value_type = T;
+
+			constexpr Point3Span() noexcept = default;
+
+			constexpr Point3Span(std::span<T> a_x, std::span<T> a_y, std::span<T> a_z) noexcept :
+				x(a_x),
+				y(a_y),
+				z(a_z)
+			{}
+
+			template <class U>
+				requires(std::is_same_v<const U, T> && !std::is_same_v<U, T>)
+			constexpr Point3Span(const Point3Span<U>& a_rhs) noexcept :
+				x(a_rhs.x),
+				y(a_rhs.y),
+				z(a_rhs.z)
+			{}
+
+			[[nodiscard]] constexpr std::size_t size() const noexcept { return std::min({ x.size(), y.size(), z.size() }); }
+
+			// members
+			std::span<T> x;  // 00
+			std::span<T> y;  // 10
+			std::span<T> z;  // 20
+		};
+
+		using SoA = Point3Span<float>;
+		using ConstSoA = Point3Span<const float>;
+
+		/// The fastest level the CPU supports, detected once.
+		[[nodiscard]] SimdLevel GetSupportedSimdLevel() noexcept;
+
+		/// The level batch operations currently run at.
+		[[nodiscard]] SimdLevel GetSimdLevel() noexcept;
+
+		/// Caps batch operations at a_level, e.g. to compare levels. Returns the level in effect,
+		/// which is never above GetSupportedSimdLevel().
+		SimdLevel SetSimdLevel(SimdLevel a_level) noexcept;
+
+		/// a_out[i] = a_matrix * a_in[i]
+		void Transform(const NiMatrix3& a_matrix, std::span<const NiPoint3> a_in, std::span<NiPoint3> a_out);
+		void Transform(const NiMatrix3& a_matrix, ConstSoA a_in, SoA a_out);
+
+		/// NiPoint3::Unitize on every point. Writes each original length to a_lengths if it is
+		/// not empty.
+		void Unitize(std::span<NiPoint3> a_points, std::span<float> a_lengths = {});
+		void Unitize(SoA a_points, std::span<float> a_lengths = {});
+
+		/// a_out[i] = a_lhs[i].Dot(a_rhs[i])
+		void Dot(std::span<const NiPoint3> a_lhs, std::span<const NiPoint3> a_rhs, std::span<float> a_out);
+		void Dot(ConstSoA a_lhs, ConstSoA a_rhs, std::span<float> a_out);
+
+		/// a_out[i] = a_lhs[i].Cross(a_rhs[i])
+		void Cross(std::span<const NiPoint3> a_lhs, std::span<const NiPoint3> a_rhs, std::span<NiPoint3> a_out);
+		void Cross(ConstSoA a_lhs, ConstSoA a_rhs, SoA a_out);
+
+		/// a_out[i].EulerAnglesToAxesZXY(a_angles[i])
+		void EulerAnglesToAxesZXY(std::span<const NiPoint3> a_angles, std::span<NiMatrix3> a_out);
+		void EulerAnglesToAxesZXY(ConstSoA a_angles, std::span<NiMatrix3> a_out);
+	}
+}
@@ -48,6 +48,24 @@ namespace RE
 		void         StopAllMagicEffects(TESObjectREFR& a_ref);
 		void         StopCombatAndAlarmOnActor(Actor* a_actor, bool a_notAlarm);
 
+		// Inlined alternatives to the std::function overloads above for per-frame scans.
+		// The callback is called directly for each element; return kStop to end early.
+		template <class F>
+			requires(std::is_invocable_r_v<BSContainer::ForEachResult, F&, Actor*>)
+		void ForAllActors(F&& a_callback);
+		template <class F>
+			requires(std::is_invocable_r_v<BSContainer::ForEachResult, F&, Actor*>)
+		void ForEachHighActor(F&& a_callback);
+		template <class F>
+			requires(std::is_invocable_r_v<BSContainer::ForEachResult, F&, BSTempEffect*>)
+		void ForEachMagicTempEffect(F&& a_callback);
+		template <class F>
+			requires(std::is_invocable_r_v<BSContainer::ForEachResult, F&, ModelReferenceEffect*>)
+		void ForEachModelEffect(F&& a_callback);
+		template <class F>
+			requires(std::is_invocable_r_v<BSContainer::ForEachResult, F&, ShaderReferenceEffect*>)
+		void ForEachShaderEffect(F&& a_callback);
+
 		// members
 		bool                                    runDetection;                                  // 001
 		bool                                    showDetectionStats;                            // 002
@@ -99,7 +117,79 @@ namespace RE
 		bool                                    updateActorsInPlayerCell;                      // 1E7
 		std::uint64_t                           unk1E8;                                        // 1E8
 	private:
+		template <class T, class F>
+		void ForEachMagicTempEffectAs(F& a_callback);
+
 		KEEP_FOR_RE()
 	};
 	static_assert(sizeof(ProcessLists) == 0x1F0);
+
+	template <class F>
+		requires(std::is_invocable_r_v<BSContainer::ForEachResult, F&, Actor*>)
+	void ProcessLists::ForAllActors(F&& a_callback)
+	{
+		for (auto& list : allProcesses) {
+			if (list) {
+				for (auto& actorHandle : *list) {
+					const auto& actor = actorHandle.get();
+					if (actor && a_callback(actor.get()) == BSContainer::ForEachResult::kStop) {
+						return;
+					}
+				}
+			}
+		}
+	}
+
+	template <class F>
+		requires(std::is_invocable_r_v<BSContainer::ForEachResult, F&, Actor*>)
+	void ProcessLists::ForEachHighActor(F&& a_callback)
+	{
+		for (auto& highActorHandle : highActorHandles) {
+			const auto& highActor = highActorHandle.get();
+			if (highActor && a_callback(highActor.get()) == BSContainer::ForEachResult::kStop) {
+				break;
+			}
+		}
+	}
+
+	template <class F>
+		requires(std::is_invocable_r_v<BSContainer::ForEachResult, F&, BSTempEffect*>)
+	void ProcessLists::ForEachMagicTempEffect(F&& a_callback)
+	{
+		BSSpinLockGuard locker(magicEffectsLock);
+
+		for (auto& tempEffectPtr : magicEffects) {
+			const auto& tempEffect = tempEffectPtr.get();
+			if (tempEffect && a_callback(tempEffect) == BSContainer::ForEachResult::kStop) {
+				break;
+			}
+		}
+	}
+
+	template <class F>
+		requires(std::is_invocable_r_v<BSContainer::ForEachResult, F&, ModelReferenceEffect*>)
+	void ProcessLists::ForEachModelEffect(F&& a_callback)
+	{
+		ForEachMagicTempEffectAs<ModelReferenceEffect>(a_callback);
+	}
+
+	template <class F>
+		requires(std::is_invocable_r_v<BSContainer::ForEachResult, F&, ShaderReferenceEffect*>)
+	void ProcessLists::ForEachShaderEffect(F&& a_callback)
+	{
+		ForEachMagicTempEffectAs<ShaderReferenceEffect>(a_callback);
+	}
+
+	// BSTempEffect::As lives in TempEffectTraits.h; the generic lambda defers the lookup to the caller's TU
+	template <class T, class F>
+	void ProcessLists::ForEachMagicTempEffectAs(F& a_callback)
+	{
+		ForEachMagicTempEffect([&a_callback](auto* a_tempEffect) {
+			const auto effect = a_tempEffect->template As<T>();
+			if (effect && a_callback(effect) == BSContainer::ForEachResult::kStop) {
+				return BSContainer::ForEachResult::kStop;
+			}
+			return BSContainer::ForEachResult::kContinue;
+		});
+	}
 }
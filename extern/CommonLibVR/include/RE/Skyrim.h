@@ -1291,6 +1291,7 @@
 #include "RE/N/NiAlphaProperty.h"
 #include "RE/N/NiAnimationKey.h"
 #include "RE/N/NiBackToFrontAccumulator.h"
+#include "RE/N/NiBatch.h"
 #include "RE/N/NiBillboardNode.h"
 #include "RE/N/NiBinaryStream.h"
 #include "RE/N/NiBoneMatrixSetterI.h"
@@ -49,6 +49,34 @@ namespace REL
 			void* _mapping{ nullptr };
 			void* _view{ nullptr };
 		};
+
+		// read-only mapping of a whole file, so loaders can parse it in place
+		class file_view
+		{
+		public:
+			file_view() noexcept = default;
+			file_view(const file_view&) = delete;
+			file_view(file_view&&) = delete;
+
+			~file_view() { close(); }
+
+			file_view& operator=(const file_view&) = delete;
+			file_view& operator=(file_view&&) = delete;
+
+			[[nodiscard]] const std::byte* data() const noexcept { return static_cast<const std::byte*>(_view); }
+			[[nodiscard]] std::size_t      size() const noexcept { return _size; }
+			[[nodiscard]] std::string_view str() const noexcept { return { static_cast<const char*>(_view), _size }; }
+
+			bool open(stl::zwstring a_filename);
+
+			void close();
+
+		private:
+			void*       _file{ nullptr };
+			void*       _mapping{ nullptr };
+			const void* _view{ nullptr };
+			std::size_t _size{ 0 };
+		};
 	}
 
 	class IDDatabase
@@ -81,12 +109,17 @@ namespace REL
 			explicit Offset2ID(ExecutionPolicy&& a_policy)
 				requires(std::is_execution_policy_v<std::decay_t<ExecutionPolicy>>)
 			{
-				const std::span<const mapping_t> id2offset = IDDatabase::get()._id2offset;
-				_offset2id.reserve(id2offset.size());
-				_offset2id.insert(_offset2id.begin(), id2offset.begin(), id2offset.end());
-				std::sort(a_policy, _offset2id.begin(), _offset2id.end(), [](auto&& a_lhs, auto&& a_rhs) {
-					return a_lhs.offset < a_rhs.offset;
-				});
+				const auto&                      db = IDDatabase::get();
+				const std::span<const mapping_t> id2offset = db._id2offset;
+				const bool                       cached = db._offset2id.size() == id2offset.size();
+				const std::span<const mapping_t> source = cached ? db._offset2id : id2offset;
+				_offset2id.reserve(source.size());
+				_offset2id.insert(_offset2id.begin(), source.begin(), source.end());
+				if (!cached) {
+					std::sort(a_policy, _offset2id.begin(), _offset2id.end(), [](auto&& a_lhs, auto&& a_rhs) {
+						return a_lhs.offset < a_rhs.offset;
+					});
+				}
 			}
 
 			Offset2ID() :
@@ -207,56 +240,55 @@ namespace REL
 	private:
 		friend class Module;
 
-		class istream_t
+		// bounds-checked cursor over an address library file held in memory
+		class reader_t
 		{
 		public:
-			using stream_type = std::ifstream;
-			using pointer = stream_type*;
-			using const_pointer = const stream_type*;
-			using reference = stream_type&;
-			using const_reference = const stream_type&;
-
-			inline istream_t(stl::zwstring a_filename, std::ios_base::openmode a_mode) :
-				_stream(a_filename.data(), a_mode)
-			{
-				if (!_stream.is_open()) {
-					stl::report_and_fail("failed to open address library file");
-				}
+			reader_t(const std::byte* a_data, std::size_t a_size) noexcept :
+				_cur(a_data),
+				_end(a_data + a_size)
+			{}
 
-				_stream.exceptions(std::ios::badbit | std::ios::failbit | std::ios::eofbit);
-			}
+			[[nodiscard]] const std::byte* data() const noexcept { return _cur; }
+			[[nodiscard]] const std::byte* end() const noexcept { return _end; }
+			[[nodiscard]] std::size_t      remaining() const noexcept { return static_cast<std::size_t>(_end - _cur); }
 
-			inline void ignore(std::streamsize a_count) { _stream.ignore(a_count); }
+			void seek(const std::byte* a_cur) noexcept { _cur = a_cur; }
 
-			template <class T>
-			inline void readin(T& a_val)
+			bool ignore(std::size_t a_count) noexcept
 			{
-				_stream.read(reinterpret_cast<char*>(std::addressof(a_val)), sizeof(T));
+				if (remaining() < a_count) {
+					return false;
+				}
+				_cur += a_count;
+				return true;
 			}
 
-			template <
-				class T,
-				std::enable_if_t<
-					std::is_arithmetic_v<T>,
-					int> = 0>
-			inline T readout()
+			template <class T>
+			bool readin(T& a_val) noexcept
 			{
-				T val{};
-				readin(val);
-				return val;
+				if (remaining() < sizeof(T)) {
+					return false;
+				}
+				std::memcpy(std::addressof(a_val), _cur, sizeof(T));
+				_cur += sizeof(T);
+				return true;
 			}
 
 		private:
-			stream_type _stream;
+			const std::byte* _cur;
+			const std::byte* _end;
 		};
 
 		class header_t
 		{
 		public:
-			void read(istream_t& a_in, std::uint8_t a_formatVersion)
+			[[nodiscard]] bool read(reader_t& a_in, std::uint8_t a_formatVersion)
 			{
 				std::int32_t format{};
-				a_in.readin(format);
+				if (!a_in.readin(format)) {
+					return false;
+				}
 				if (format != a_formatVersion) {
 					stl::report_and_fail(
 						std::format(
@@ -269,16 +301,20 @@ namespace REL
 
 				std::int32_t version[4]{};
 				std::int32_t nameLen{};
-				a_in.readin(version);
-				a_in.readin(nameLen);
-				a_in.ignore(nameLen);
-
-				a_in.readin(_pointerSize);
-				a_in.readin(_addressCount);
+				if (!a_in.readin(version) ||
+					!a_in.readin(nameLen) ||
+					nameLen < 0 ||
+					!a_in.ignore(static_cast<std::size_t>(nameLen)) ||
+					!a_in.readin(_pointerSize) ||
+					!a_in.readin(_addressCount) ||
+					_addressCount < 0) {
+					return false;
+				}
 
 				for (std::size_t i = 0; i < std::extent_v<decltype(version)>; ++i) {
 					_version[i] = static_cast<std::uint16_t>(version[i]);
 				}
+				return true;
 			}
 
 			[[nodiscard]] std::size_t address_count() const noexcept { return static_cast<std::size_t>(_addressCount); }
@@ -332,102 +368,46 @@ namespace REL
 		bool load_csv(stl::zwstring a_filename, Version a_version, bool a_failOnError);
 #endif
 
-		bool unpack_file(istream_t& a_in, header_t a_header, bool a_failOnError)
-		{
-			std::uint8_t  type = 0;
-			std::uint64_t id = 0;
-			std::uint64_t offset = 0;
-			std::uint64_t prevID = 0;
-			std::uint64_t prevOffset = 0;
-			for (auto& mapping : _id2offset) {
-				a_in.readin(type);
-				const auto lo = static_cast<std::uint8_t>(type & 0xF);
-				const auto hi = static_cast<std::uint8_t>(type >> 4);
-
-				switch (lo) {
-				case 0:
-					a_in.readin(id);
-					break;
-				case 1:
-					id = prevID + 1;
-					break;
-				case 2:
-					id = prevID + a_in.readout<std::uint8_t>();
-					break;
-				case 3:
-					id = prevID - a_in.readout<std::uint8_t>();
-					break;
-				case 4:
-					id = prevID + a_in.readout<std::uint16_t>();
-					break;
-				case 5:
-					id = prevID - a_in.readout<std::uint16_t>();
-					break;
-				case 6:
-					id = a_in.readout<std::uint16_t>();
-					break;
-				case 7:
-					id = a_in.readout<std::uint32_t>();
-					break;
-				default:
-					return stl::report_and_error("unhandled type"sv, a_failOnError);
-				}
+		bool unpack_file(reader_t& a_in, header_t a_header, bool a_failOnError);
 
-				const std::uint64_t tmp = (hi & 8) != 0 ? (prevOffset / a_header.pointer_size()) : prevOffset;
-
-				switch (hi & 7) {
-				case 0:
-					a_in.readin(offset);
-					break;
-				case 1:
-					offset = tmp + 1;
-					break;
-				case 2:
-					offset = tmp + a_in.readout<std::uint8_t>();
-					break;
-				case 3:
-					offset = tmp - a_in.readout<std::uint8_t>();
-					break;
-				case 4:
-					offset = tmp + a_in.readout<std::uint16_t>();
-					break;
-				case 5:
-					offset = tmp - a_in.readout<std::uint16_t>();
-					break;
-				case 6:
-					offset = a_in.readout<std::uint16_t>();
-					break;
-				case 7:
-					offset = a_in.readout<std::uint32_t>();
-					break;
-				default:
-					return stl::report_and_error("unhandled type"sv, a_failOnError);
-				}
-
-				if ((hi & 8) != 0) {
-					offset *= a_header.pointer_size();
-				}
+		// Identifies the library a cache was built from: a cache written for another
+		// game version or another revision of the file is ignored and rebuilt.
+		struct cache_key_t
+		{
+			Version       version;
+			std::uint64_t size{ 0 };
+			std::uint64_t hash{ 0 };
+		};
 
-				mapping = { id, offset };
+		[[nodiscard]] static cache_key_t make_cache_key(const detail::file_view& a_file, Version a_version) noexcept;
 
-				prevOffset = offset;
-				prevID = id;
-			}
+		// Maps <library>.cache, which holds the id-sorted and offset-sorted tables for
+		// a_key, and points _offset2id into it. Returns the cached id2offset table, or
+		// an empty span if there is no valid cache for this library.
+		std::span<const mapping_t> load_cache(stl::zwstring a_filename, const cache_key_t& a_key);
 
-			return true;
-		}
+		// Writes the cache for the freshly decoded _id2offset and maps it. Failures
+		// are ignored; the next start simply decodes the library again.
+		void store_cache(stl::zwstring a_filename, const cache_key_t& a_key);
 
 		void clear()
 		{
+			_cache.close();
+			_offset2id = {};
 			_mmap.close();
 			_id2offset = {};
 		}
 
+		// entry count from which an out-of-order database is sorted in parallel
+		static constexpr std::size_t parallel_sort_threshold{ 1u << 16 };
+
 		static IDDatabase              _instance;
 		static inline std::atomic_bool _initialized{ false };
 		static inline std::mutex       _initLock;
 		detail::memory_map             _mmap;
 		std::span<mapping_t>           _id2offset;
+		detail::file_view              _cache;
+		std::span<const mapping_t>     _offset2id;
 
 #ifdef ENABLE_SKYRIM_VR
 		Version _vrAddressLibraryVersion;
@@ -46,6 +46,22 @@ namespace REX::W32
 	inline constexpr auto FILE_ATTRIBUTE_SYSTEM{ 0x00000004u };
 	inline constexpr auto FILE_ATTRIBUTE_DIRECTORY{ 0x00000010u };
 	inline constexpr auto FILE_ATTRIBUTE_ARCHIVE{ 0x00000020u };
+	inline constexpr auto FILE_ATTRIBUTE_NORMAL{ 0x00000080u };
+
+	// file flags
+	inline constexpr auto FILE_FLAG_SEQUENTIAL_SCAN{ 0x08000000u };
+
+	// file share modes
+	inline constexpr auto FILE_SHARE_READ{ 0x00000001u };
+	inline constexpr auto FILE_SHARE_WRITE{ 0x00000002u };
+	inline constexpr auto FILE_SHARE_DELETE{ 0x00000004u };
+
+	// file creation dispositions
+	inline constexpr auto CREATE_NEW{ 1u };
+	inline constexpr auto CREATE_ALWAYS{ 2u };
+	inline constexpr auto OPEN_EXISTING{ 3u };
+	inline constexpr auto OPEN_ALWAYS{ 4u };
+	inline constexpr auto TRUNCATE_EXISTING{ 5u };
 
 	// file mapping flags
 	inline constexpr auto FILE_MAP_ALL_ACCESS{ SECTION_ALL_ACCESS };
@@ -426,6 +442,8 @@ namespace REX::W32
 namespace REX::W32
 {
 	bool                  CloseHandle(HANDLE a_handle) noexcept;
+	HANDLE                CreateFileA(const char* a_fileName, std::uint32_t a_desiredAccess, std::uint32_t a_shareMode, SECURITY_ATTRIBUTES* a_attributes, std::uint32_t a_creationDisposition, std::uint32_t a_flags, HANDLE a_templateFile);
+	HANDLE                CreateFileW(const wchar_t* a_fileName, std::uint32_t a_desiredAccess, std::uint32_t a_shareMode, SECURITY_ATTRIBUTES* a_attributes, std::uint32_t a_creationDisposition, std::uint32_t a_flags, HANDLE a_templateFile);
 	HANDLE                CreateFileMappingA(HANDLE a_file, SECURITY_ATTRIBUTES* a_attributes, std::uint32_t a_protect, std::uint32_t a_maxSizeHigh, std::uint32_t a_maxSizeLow, const char* a_name) noexcept;
 	HANDLE                CreateFileMappingW(HANDLE a_file, SECURITY_ATTRIBUTES* a_attributes, std::uint32_t a_protect, std::uint32_t a_maxSizeHigh, std::uint32_t a_maxSizeLow, const wchar_t* a_name) noexcept;
 	bool                  CreateProcessA(const char* a_name, char* a_cmd, SECURITY_ATTRIBUTES* a_procAttr, SECURITY_ATTRIBUTES* a_threadAttr, bool a_inheritHandles, std::uint32_t a_flags, void* a_env, const char* a_curDir, STARTUPINFOA* a_startInfo, PROCESS_INFORMATION* a_procInfo) noexcept;
@@ -449,6 +467,7 @@ namespace REX::W32
 	std::uint32_t         GetCurrentThreadId() noexcept;
 	std::uint32_t         GetEnvironmentVariableA(const char* a_name, char* a_buf, std::uint32_t a_bufLen) noexcept;
 	std::uint32_t         GetEnvironmentVariableW(const wchar_t* a_name, wchar_t* a_buf, std::uint32_t a_bufLen) noexcept;
+	bool                  GetFileSizeEx(HANDLE a_file, LARGE_INTEGER* a_fileSize) noexcept;
 	std::uint32_t         GetLastError() noexcept;
 	std::uint32_t         GetModuleFileNameA(HMODULE a_module, char* a_name, std::uint32_t a_nameLen) noexcept;
 	std::uint32_t         GetModuleFileNameW(HMODULE a_module, wchar_t* a_name, std::uint32_t a_nameLen) noexcept;
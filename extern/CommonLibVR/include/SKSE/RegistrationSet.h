@@ -16,6 +16,109 @@ namespace SKSE
 {
 	namespace Impl
 	{
+		// Sorted, contiguous set of handles published as immutable snapshots. Writers
+		// serialise on their owner's lock and swap in an updated copy, so readers can
+		// iterate a snapshot without locking and never see a half-applied change.
+		class FlatHandleSet
+		{
+		public:
+			using container_type = std::vector<RE::VMHandle>;
+			using snapshot_type = std::shared_ptr<const container_type>;
+
+			FlatHandleSet() noexcept = default;
+			FlatHandleSet(const FlatHandleSet& a_rhs) noexcept :
+				_snapshot(a_rhs.snapshot())
+			{}
+			FlatHandleSet(FlatHandleSet&& a_rhs) noexcept :
+				_snapshot(a_rhs._snapshot.exchange(nullptr))
+			{}
+
+			~FlatHandleSet() = default;
+
+			FlatHandleSet& operator=(const FlatHandleSet& a_rhs) noexcept
+			{
+				if (this != std::addressof(a_rhs)) {
+					_snapshot.store(a_rhs.snapshot());
+				}
+				return *this;
+			}
+
+			FlatHandleSet& operator=(FlatHandleSet&& a_rhs) noexcept
+			{
+				if (this != std::addressof(a_rhs)) {
+					_snapshot.store(a_rhs._snapshot.exchange(nullptr));
+				}
+				return *this;
+			}
+
+			// empty sets publish no snapshot
+			[[nodiscard]] snapshot_type snapshot() const noexcept { return _snapshot.load(std::memory_order_acquire); }
+
+			[[nodiscard]] std::size_t size() const noexcept
+			{
+				const auto handles = snapshot();
+				return handles ? handles->size() : 0;
+			}
+
+			[[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+			[[nodiscard]] bool contains(RE::VMHandle a_handle) const noexcept
+			{
+				const auto handles = snapshot();
+				return handles && std::binary_search(handles->begin(), handles->end(), a_handle);
+			}
+
+			bool insert(RE::VMHandle a_handle)
+			{
+				const auto handles = snapshot();
+				auto       updated = handles ? container_type(*handles) : container_type();
+				const auto it = std::lower_bound(updated.begin(), updated.end(), a_handle);
+				if (it != updated.end() && *it == a_handle) {
+					return false;
+				}
+				updated.insert(it, a_handle);
+				publish(std::move(updated));
+				return true;
+			}
+
+			bool erase(RE::VMHandle a_handle)
+			{
+				const auto handles = snapshot();
+				if (!handles) {
+					return false;
+				}
+				const auto it = std::lower_bound(handles->begin(), handles->end(), a_handle);
+				if (it == handles->end() || *it != a_handle) {
+					return false;
+				}
+				container_type updated;
+				updated.reserve(handles->size() - 1);
+				updated.insert(updated.end(), handles->begin(), it);
+				updated.insert(updated.end(), std::next(it), handles->end());
+				publish(std::move(updated));
+				return true;
+			}
+
+			void assign(container_type a_handles)
+			{
+				std::sort(a_handles.begin(), a_handles.end());
+				a_handles.erase(std::unique(a_handles.begin(), a_handles.end()), a_handles.end());
+				publish(std::move(a_handles));
+			}
+
+			void clear() noexcept { _snapshot.store(nullptr); }
+
+		private:
+			void publish(container_type a_handles)
+			{
+				_snapshot.store(
+					a_handles.empty() ? nullptr : std::make_shared<const container_type>(std::move(a_handles)),
+					std::memory_order_release);
+			}
+
+			std::atomic<snapshot_type> _snapshot;
+		};
+
 		class RegistrationSetBase
 		{
 		public:
@@ -48,9 +151,9 @@ namespace SKSE
 			bool Register(const void* a_object, RE::VMTypeID a_typeID);
 			bool Unregister(const void* a_object, RE::VMTypeID a_typeID);
 
-			std::set<RE::VMHandle> _handles;
-			std::string            _eventName;
-			mutable Lock           _lock;
+			FlatHandleSet _handles;
+			std::string   _eventName;
+			mutable Lock  _lock;
 		};
 
 		template <class Enable, class... Args>
@@ -83,10 +186,15 @@ namespace SKSE
 
 			inline void SendEvent(Args... a_args)
 			{
+				const auto handles = _handles.snapshot();
+				if (!handles) {
+					return;
+				}
+
 				RE::BSFixedString eventName(_eventName);
 
 				auto vm = RE::BSScript::Internal::VirtualMachine::GetSingleton();
-				for (auto& handle : _handles) {
+				for (const auto handle : *handles) {
 					auto copy = std::make_tuple(a_args...);
 					std::apply([&](auto&&... a_copy) {
 						auto args = RE::MakeFunctionArguments(std::forward<Args>(a_copy)...);
@@ -138,11 +246,16 @@ namespace SKSE
 
 			inline void SendEvent()
 			{
+				const auto handles = _handles.snapshot();
+				if (!handles) {
+					return;
+				}
+
 				RE::BSFixedString eventName(_eventName);
 
 				auto vm = RE::BSScript::Internal::VirtualMachine::GetSingleton();
 				if (vm) {
-					for (auto& handle : _handles) {
+					for (const auto handle : *handles) {
 						auto args = RE::MakeFunctionArguments();
 						vm->SendEvent(handle, eventName, args);
 					}
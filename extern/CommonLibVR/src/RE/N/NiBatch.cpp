@@ -0,0 +1,538 @@
+#include "RE/N/NiBatch.h"
+
+// MSVC accepts every intrinsic regardless of /arch, so both vector paths are always built and
+// chosen at runtime. Other compilers only build the paths their target flags allow.
+#if defined(_MSC_VER) && !defined(__clang__)
+#	define RE_NIBATCH_SSE41 1
+#	define RE_NIBATCH_AVX2 1
+#else
+#	include <cpuid.h>
+#	if defined(__SSE4_1__)
+#		define RE_NIBATCH_SSE41 1
+#	endif
+#	if defined(__AVX2__)
+#		define RE_NIBATCH_AVX2 1
+#	endif
+#endif
+
+#if defined(RE_NIBATCH_SSE41) || defined(RE_NIBATCH_AVX2)
+#	include <immintrin.h>
+#endif
+
+namespace RE::NiBatch
+{
+	namespace
+	{
+		struct ScalarOps
+		{
+			using V = float;
+			using M = bool;
+
+			static constexpr std::size_t width = 1;
+
+			static V    load(const float* a_src) { return *a_src; }
+			static void store(float* a_dst, V a_value) { *a_dst = a_value; }
+			static V    set(float a_value) { return a_value; }
+			static V    sqrt(V a_value) { return std::sqrt(a_value); }
+			static V    round(V a_value) { return std::nearbyint(a_value); }
+			static V    floor(V a_value) { return std::floor(a_value); }
+			static M    greater(V a_lhs, V a_rhs) { return a_lhs > a_rhs; }
+			static M    greater_equal(V a_lhs, V a_rhs) { return a_lhs >= a_rhs; }
+			static M    equal(V a_lhs, V a_rhs) { return a_lhs == a_rhs; }
+			static M    either(M a_lhs, M a_rhs) { return a_lhs || a_rhs; }
+			static V    select(M a_mask, V a_true, V a_false) { return a_mask ? a_true : a_false; }
+			static void transpose(V (&)[width]) {}
+		};
+
+#ifdef RE_NIBATCH_SSE41
+		struct SSE41Ops
+		{
+			struct V
+			{
+				friend V operator+(V a_lhs, V a_rhs) { return { _mm_add_ps(a_lhs.v, a_rhs.v) }; }
+				friend V operator-(V a_lhs, V a_rhs) { return { _mm_sub_ps(a_lhs.v, a_rhs.v) }; }
+				friend V operator*(V a_lhs, V a_rhs) { return { _mm_mul_ps(a_lhs.v, a_rhs.v) }; }
+				friend V operator/(V a_lhs, V a_rhs) { return { _mm_div_ps(a_lhs.v, a_rhs.v) }; }
+				friend V operator-(V a_value) { return { _mm_xor_ps(a_value.v, _mm_set1_ps(-0.0F)) }; }
+
+				// members
+				__m128 v;
+			};
+			using M = V;
+
+			static constexpr std::size_t width = 4;
+
+			static V    load(const float* a_src) { return { _mm_loadu_ps(a_src) }; }
+			static void store(float* a_dst, V a_value) { _mm_storeu_ps(a_dst, a_value.v); }
+			static V    set(float a_value) { return { _mm_set1_ps(a_value) }; }
+			static V    sqrt(V a_value) { return { _mm_sqrt_ps(a_value.v) }; }
+			static V    round(V a_value) { return { _mm_round_ps(a_value.v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC) }; }
+			static V    floor(V a_value) { return { _mm_floor_ps(a_value.v) }; }
+			static M    greater(V a_lhs, V a_rhs) { return { _mm_cmpgt_ps(a_lhs.v, a_rhs.v) }; }
+			static M    greater_equal(V a_lhs, V a_rhs) { return { _mm_cmpge_ps(a_lhs.v, a_rhs.v) }; }
+			static M    equal(V a_lhs, V a_rhs) { return { _mm_cmpeq_ps(a_lhs.v, a_rhs.v) }; }
+			static M    either(M a_lhs, M a_rhs) { return { _mm_or_ps(a_lhs.v, a_rhs.v) }; }
+			static V    select(M a_mask, V a_true, V a_false) { return { _mm_blendv_ps(a_false.v, a_true.v, a_mask.v) }; }
+
+			static void transpose(V (&a_rows)[width])
+			{
+				_MM_TRANSPOSE4_PS(a_rows[0].v, a_rows[1].v, a_rows[2].v, a_rows[3].v);
+			}
+		};
+#endif
+
+#ifdef RE_NIBATCH_AVX2
+		struct AVX2Ops
+		{
+			struct V
+			{
+				friend V operator+(V a_lhs, V a_rhs) { return { _mm256_add_ps(a_lhs.v, a_rhs.v) }; }
+				friend V operator-(V a_lhs, V a_rhs) { return { _mm256_sub_ps(a_lhs.v, a_rhs.v) }; }
+				friend V operator*(V a_lhs, V a_rhs) { return { _mm256_mul_ps(a_lhs.v, a_rhs.v) }; }
+				friend V operator/(V a_lhs, V a_rhs) { return { _mm256_div_ps(a_lhs.v, a_rhs.v) }; }
+				friend V operator-(V a_value) { return { _mm256_xor_ps(a_value.v, _mm256_set1_ps(-0.0F)) }; }
+
+				// members
+				__m256 v;
+			};
+			using M = V;
+
+			static constexpr std::size_t width = 8;
+
+			static V    load(const float* a_src) { return { _mm256_loadu_ps(a_src) }; }
+			static void store(float* a_dst, V a_value) { _mm256_storeu_ps(a_dst, a_value.v); }
+			static V    set(float a_value) { return { _mm256_set1_ps(a_value) }; }
+			static V    sqrt(V a_value) { return { _mm256_sqrt_ps(a_value.v) }; }
+			static V    round(V a_value) { return { _mm256_round_ps(a_value.v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC) }; }
+			static V    floor(V a_value) { return { _mm256_floor_ps(a_value.v) }; }
+			static M    greater(V a_lhs, V a_rhs) { return { _mm256_cmp_ps(a_lhs.v, a_rhs.v, _CMP_GT_OQ) }; }
+			static M    greater_equal(V a_lhs, V a_rhs) { return { _mm256_cmp_ps(a_lhs.v, a_rhs.v, _CMP_GE_OQ) }; }
+			static M    equal(V a_lhs, V a_rhs) { return { _mm256_cmp_ps(a_lhs.v, a_rhs.v, _CMP_EQ_OQ) }; }
+			static M    either(M a_lhs, M a_rhs) { return { _mm256_or_ps(a_lhs.v, a_rhs.v) }; }
+			static V    select(M a_mask, V a_true, V a_false) { return { _mm256_blendv_ps(a_false.v, a_true.v, a_mask.v) }; }
+
+			static void transpose(V (&a_rows)[width])
+			{
+				const auto t0 = _mm256_unpacklo_ps(a_rows[0].v, a_rows[1].v);
+				const auto t1 = _mm256_unpackhi_ps(a_rows[0].v, a_rows[1].v);
+				const auto t2 = _mm256_unpacklo_ps(a_rows[2].v, a_rows[3].v);
+				const auto t3 = _mm256_unpackhi_ps(a_rows[2].v, a_rows[3].v);
+				const auto t4 = _mm256_unpacklo_ps(a_rows[4].v, a_rows[5].v);
+				const auto t5 = _mm256_unpackhi_ps(a_rows[4].v, a_rows[5].v);
+				const auto t6 = _mm256_unpacklo_ps(a_rows[6].v, a_rows[7].v);
+				const auto t7 = _mm256_unpackhi_ps(a_rows[6].v, a_rows[7].v);
+
+				const auto s0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+				const auto s1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+				const auto s2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+				const auto s3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+				const auto s4 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(1, 0, 1, 0));
+				const auto s5 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(3, 2, 3, 2));
+				const auto s6 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(1, 0, 1, 0));
+				const auto s7 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(3, 2, 3, 2));
+
+				a_rows[0].v = _mm256_permute2f128_ps(s0, s4, 0x20);
+				a_rows[1].v = _mm256_permute2f128_ps(s1, s5, 0x20);
+				a_rows[2].v = _mm256_permute2f128_ps(s2, s6, 0x20);
+				a_rows[3].v = _mm256_permute2f128_ps(s3, s7, 0x20);
+				a_rows[4].v = _mm256_permute2f128_ps(s0, s4, 0x31);
+				a_rows[5].v = _mm256_permute2f128_ps(s1, s5, 0x31);
+				a_rows[6].v = _mm256_permute2f128_ps(s2, s6, 0x31);
+				a_rows[7].v = _mm256_permute2f128_ps(s3, s7, 0x31);
+			}
+		};
+#endif
+
+		template <class O>
+		struct Lanes3
+		{
+			typename O::V x;
+			typename O::V y;
+			typename O::V z;
+		};
+
+		// SoA spans load straight into registers; NiPoint3 arrays are transposed through the stack
+		template <class O>
+		Lanes3<O> load3(ConstSoA a_src, std::size_t a_index)
+		{
+			return { O::load(a_src.x.data() + a_index), O::load(a_src.y.data() + a_index), O::load(a_src.z.data() + a_index) };
+		}
+
+		template <class O>
+		Lanes3<O> load3(std::span<const NiPoint3> a_src, std::size_t a_index)
+		{
+			alignas(32) float x[O::width];
+			alignas(32) float y[O::width];
+			alignas(32) float z[O::width];
+			for (std::size_t i = 0; i < O::width; ++i) {
+				const auto& point = a_src[a_index + i];
+				x[i] = point.x;
+				y[i] = point.y;
+				z[i] = point.z;
+			}
+			return { O::load(x), O::load(y), O::load(z) };
+		}
+
+		template <class O>
+		void store3(SoA a_dst, std::size_t a_index, const Lanes3<O>& a_value)
+		{
+			O::store(a_dst.x.data() + a_index, a_value.x);
+			O::store(a_dst.y.data() + a_index, a_value.y);
+			O::store(a_dst.z.data() + a_index, a_value.z);
+		}
+
+		template <class O>
+		void store3(std::span<NiPoint3> a_dst, std::size_t a_index, const Lanes3<O>& a_value)
+		{
+			alignas(32) float x[O::width];
+			alignas(32) float y[O::width];
+			alignas(32) float z[O::width];
+			O::store(x, a_value.x);
+			O::store(y, a_value.y);
+			O::store(z, a_value.z);
+			for (std::size_t i = 0; i < O::width; ++i) {
+				a_dst[a_index + i] = NiPoint3(x[i], y[i], z[i]);
+			}
+		}
+
+		// Transposes the entries a vector at a time so each matrix is written with whole-vector
+		// stores; the entries that do not fill a vector go through the stack
+		template <class O>
+		void store_matrices(std::span<NiMatrix3> a_dst, std::size_t a_index, const typename O::V (&a_entries)[9])
+		{
+			constexpr std::size_t whole = 9 - 9 % O::width;
+			for (std::size_t e = 0; e < whole; e += O::width) {
+				typename O::V rows[O::width];
+				std::copy_n(a_entries + e, O::width, rows);
+				O::transpose(rows);
+				for (std::size_t i = 0; i < O::width; ++i) {
+					O::store(std::addressof(a_dst[a_index + i].entry[0][0]) + e, rows[i]);
+				}
+			}
+
+			if constexpr (whole < 9) {
+				alignas(32) float rest[9 - whole][O::width];
+				for (std::size_t e = whole; e < 9; ++e) {
+					O::store(rest[e - whole], a_entries[e]);
+				}
+				for (std::size_t i = 0; i < O::width; ++i) {
+					for (std::size_t e = whole; e < 9; ++e) {
+						std::addressof(a_dst[a_index + i].entry[0][0])[e] = rest[e - whole][i];
+					}
+				}
+			}
+		}
+
+		template <class O>
+		Lanes3<O> transform(const NiMatrix3& a_matrix, const Lanes3<O>& a_point)
+		{
+			const auto& m = a_matrix.entry;
+			return {
+				O::set(m[0][0]) * a_point.x + O::set(m[0][1]) * a_point.y + O::set(m[0][2]) * a_point.z,
+				O::set(m[1][0]) * a_point.x + O::set(m[1][1]) * a_point.y + O::set(m[1][2]) * a_point.z,
+				O::set(m[2][0]) * a_point.x + O::set(m[2][1]) * a_point.y + O::set(m[2][2]) * a_point.z
+			};
+		}
+
+		template <class O>
+		typename O::V dot(const Lanes3<O>& a_lhs, const Lanes3<O>& a_rhs)
+		{
+			return a_lhs.x * a_rhs.x + a_lhs.y * a_rhs.y + a_lhs.z * a_rhs.z;
+		}
+
+		template <class O>
+		Lanes3<O> cross(const Lanes3<O>& a_lhs, const Lanes3<O>& a_rhs)
+		{
+			return {
+				a_lhs.y * a_rhs.z - a_lhs.z * a_rhs.y,
+				a_lhs.z * a_rhs.x - a_lhs.x * a_rhs.z,
+				a_lhs.x * a_rhs.y - a_lhs.y * a_rhs.x
+			};
+		}
+
+		// Same outcome as NiPoint3::Unitize: a length of exactly 1 divides through unchanged, and
+		// anything at or below FLT_EPSILON (or NaN) becomes the zero vector with length 0
+		template <class O>
+		typename O::V unitize(Lanes3<O>& a_point)
+		{
+			const auto length = O::sqrt(dot<O>(a_point, a_point));
+			const auto valid = O::greater(length, O::set(FLT_EPSILON));
+			const auto inverse = O::set(1.0F) / length;
+			const auto zero = O::set(0.0F);
+			a_point.x = O::select(valid, a_point.x * inverse, zero);
+			a_point.y = O::select(valid, a_point.y * inverse, zero);
+			a_point.z = O::select(valid, a_point.z * inverse, zero);
+			return O::select(valid, length, zero);
+		}
+
+		// Cody-Waite reduction to [-pi/4, pi/4] around the nearest multiple of pi/2, then the
+		// Cephes single-precision polynomials. Every level evaluates exactly these steps.
+		template <class O>
+		void sincos(typename O::V a_angle, typename O::V& a_sin, typename O::V& a_cos)
+		{
+			const auto quadrant = O::round(a_angle * O::set(0.636619772F));
+			auto       r = a_angle - quadrant * O::set(1.5703125F);
+			r = r - quadrant * O::set(4.837512969970703125e-4F);
+			r = r - quadrant * O::set(7.54978995489188216e-8F);
+
+			const auto z = r * r;
+			const auto sinr = ((O::set(-1.9515295891e-4F) * z + O::set(8.3321608736e-3F)) * z + O::set(-1.6666654611e-1F)) * z * r + r;
+			const auto cosr = ((O::set(2.443315711809948e-5F) * z + O::set(-1.388731625493765e-3F)) * z + O::set(4.166664568298827e-2F)) * z * z -
+			                  O::set(0.5F) * z + O::set(1.0F);
+
+			const auto q = quadrant - O::floor(quadrant * O::set(0.25F)) * O::set(4.0F);
+			const auto one = O::equal(q, O::set(1.0F));
+			const auto two = O::equal(q, O::set(2.0F));
+			const auto swap = O::either(one, O::equal(q, O::set(3.0F)));
+			const auto sinv = O::select(swap, cosr, sinr);
+			const auto cosv = O::select(swap, sinr, cosr);
+			a_sin = O::select(O::greater_equal(q, O::set(2.0F)), -sinv, sinv);
+			a_cos = O::select(O::either(one, two), -cosv, cosv);
+		}
+
+		// Same entries as NiMatrix3::EulerAnglesToAxesZXY
+		template <class O>
+		void euler_zxy(const Lanes3<O>& a_angles, typename O::V (&a_entries)[9])
+		{
+			typename O::V sinx, cosx, siny, cosy, sinz, cosz;
+			sincos<O>(a_angles.x, sinx, cosx);
+			sincos<O>(a_angles.y, siny, cosy);
+			sincos<O>(a_angles.z, sinz, cosz);
+
+			a_entries[0] = cosz * cosy + sinz * sinx * siny;
+			a_entries[1] = sinz * cosx;
+			a_entries[2] = -cosz * siny + sinz * sinx * cosy;
+			a_entries[3] = -sinz * cosy + cosz * sinx * siny;
+			a_entries[4] = cosz * cosx;
+			a_entries[5] = sinz * siny + cosz * sinx * cosy;
+			a_entries[6] = cosx * siny;
+			a_entries[7] = -sinx;
+			a_entries[8] = cosx * cosy;
+		}
+
+		SimdLevel detect_simd_level() noexcept
+		{
+			const auto cpuid = [](int a_leaf, int (&a_info)[4]) {
+#if defined(_MSC_VER) && !defined(__clang__)
+				__cpuidex(a_info, a_leaf, 0);
+#else
+				__cpuid_count(a_leaf, 0, a_info[0], a_info[1], a_info[2], a_info[3]);
+#endif
+			};
+			const auto xcr0 = []() -> std::uint64_t {
+#if defined(_MSC_VER) && !defined(__clang__)
+				return _xgetbv(0);
+#else
+				std::uint32_t lo = 0;
+				std::uint32_t hi = 0;
+				__asm__("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+				return (static_cast<std::uint64_t>(hi) << 32) | lo;
+#endif
+			};
+
+			int info[4]{};
+			cpuid(0, info);
+			const auto maxLeaf = info[0];
+
+			cpuid(1, info);
+			[[maybe_unused]] const bool sse41 = (info[2] & (1 << 19)) != 0;
+			const bool osxsave = (info[2] & (1 << 27)) != 0;
+			const bool avx = (info[2] & (1 << 28)) != 0;
+
+			[[maybe_unused]] bool avx2 = false;
+			if (maxLeaf >= 7 && osxsave && avx && (xcr0() & 0x6) == 0x6) {
+				cpuid(7, info);
+				avx2 = (info[1] & (1 << 5)) != 0;
+			}
+
+#ifdef RE_NIBATCH_AVX2
+			if (avx2) {
+				return SimdLevel::kAVX2;
+			}
+#endif
+#ifdef RE_NIBATCH_SSE41
+			if (sse41) {
+				return SimdLevel::kSSE41;
+			}
+#endif
+			return SimdLevel::kScalar;
+		}
+
+		std::atomic<SimdLevel>& active_simd_level() noexcept
+		{
+			static std::atomic<SimdLevel> level{ GetSupportedSimdLevel() };
+			return level;
+		}
+
+		// Calls a_func with the ops of the active level
+		template <class F>
+		void dispatch(F&& a_func)
+		{
+			switch (active_simd_level().load(std::memory_order_relaxed)) {
+#ifdef RE_NIBATCH_AVX2
+			case SimdLevel::kAVX2:
+				return a_func(AVX2Ops{});
+#endif
+#ifdef RE_NIBATCH_SSE41
+			case SimdLevel::kSSE41:
+				return a_func(SSE41Ops{});
+#endif
+			default:
+				return a_func(ScalarOps{});
+			}
+		}
+
+		// Runs a_body over whole vectors of O, then over the remainder one point at a time
+		template <class O, class F>
+		void for_each_block(std::size_t a_count, F&& a_body)
+		{
+			std::size_t i = 0;
+			for (; i + O::width <= a_count; i += O::width) {
+				a_body(O{}, i);
+			}
+			for (; i < a_count; ++i) {
+				a_body(ScalarOps{}, i);
+			}
+		}
+
+		template <class In, class Out>
+		void transform_all(const NiMatrix3& a_matrix, In a_in, Out a_out)
+		{
+			assert(a_in.size() == a_out.size());
+			const auto count = std::min(a_in.size(), a_out.size());
+			dispatch([&](auto a_simd) {
+				for_each_block<decltype(a_simd)>(count, [&](auto a_ops, std::size_t a_index) {
+					using O = decltype(a_ops);
+					store3<O>(a_out, a_index, transform<O>(a_matrix, load3<O>(a_in, a_index)));
+				});
+			});
+		}
+
+		template <class Points>
+		void unitize_all(Points a_points, std::span<float> a_lengths)
+		{
+			assert(a_lengths.empty() || a_lengths.size() == a_points.size());
+			const auto count = a_lengths.empty() ? a_points.size() : std::min(a_points.size(), a_lengths.size());
+			dispatch([&](auto a_simd) {
+				for_each_block<decltype(a_simd)>(count, [&](auto a_ops, std::size_t a_index) {
+					using O = decltype(a_ops);
+					auto       point = load3<O>(a_points, a_index);
+					const auto length = unitize<O>(point);
+					store3<O>(a_points, a_index, point);
+					if (!a_lengths.empty()) {
+						O::store(a_lengths.data() + a_index, length);
+					}
+				});
+			});
+		}
+
+		template <class In>
+		void dot_all(In a_lhs, In a_rhs, std::span<float> a_out)
+		{
+			assert(a_lhs.size() == a_rhs.size() && a_lhs.size() == a_out.size());
+			const auto count = std::min({ a_lhs.size(), a_rhs.size(), a_out.size() });
+			dispatch([&](auto a_simd) {
+				for_each_block<decltype(a_simd)>(count, [&](auto a_ops, std::size_t a_index) {
+					using O = decltype(a_ops);
+					O::store(a_out.data() + a_index, dot<O>(load3<O>(a_lhs, a_index), load3<O>(a_rhs, a_index)));
+				});
+			});
+		}
+
+		template <class In, class Out>
+		void cross_all(In a_lhs, In a_rhs, Out a_out)
+		{
+			assert(a_lhs.size() == a_rhs.size() && a_lhs.size() == a_out.size());
+			const auto count = std::min({ a_lhs.size(), a_rhs.size(), a_out.size() });
+			dispatch([&](auto a_simd) {
+				for_each_block<decltype(a_simd)>(count, [&](auto a_ops, std::size_t a_index) {
+					using O = decltype(a_ops);
+					store3<O>(a_out, a_index, cross<O>(load3<O>(a_lhs, a_index), load3<O>(a_rhs, a_index)));
+				});
+			});
+		}
+
+		template <class In>
+		void euler_all(In a_angles, std::span<NiMatrix3> a_out)
+		{
+			assert(a_angles.size() == a_out.size());
+			const auto count = std::min(a_angles.size(), a_out.size());
+			dispatch([&](auto a_simd) {
+				for_each_block<decltype(a_simd)>(count, [&](auto a_ops, std::size_t a_index) {
+					using O = decltype(a_ops);
+					typename O::V entries[9];
+					euler_zxy<O>(load3<O>(a_angles, a_index), entries);
+					store_matrices<O>(a_out, a_index, entries);
+				});
+			});
+		}
+	}
+
+	SimdLevel GetSupportedSimdLevel() noexcept
+	{
+		static const auto supported = detect_simd_level();
+		return supported;
+	}
+
+	SimdLevel GetSimdLevel() noexcept
+	{
+		return active_simd_level().load(std::memory_order_relaxed);
+	}
+
+	SimdLevel SetSimdLevel(SimdLevel a_level) noexcept
+	{
+		const auto level = std::min(a_level, GetSupportedSimdLevel());
+		active_simd_level().store(level, std::memory_order_relaxed);
+		return level;
+	}
+
+	void Transform(const NiMatrix3& a_matrix, std::span<const NiPoint3> a_in, std::span<NiPoint3> a_out)
+	{
+		transform_all(a_matrix, a_in, a_out);
+	}
+
+	void Transform(const NiMatrix3& a_matrix, ConstSoA a_in, SoA a_out)
+	{
+		transform_all(a_matrix, a_in, a_out);
+	}
+
+	void Unitize(std::span<NiPoint3> a_points, std::span<float> a_lengths)
+	{
+		unitize_all(a_points, a_lengths);
+	}
+
+	void Unitize(SoA a_points, std::span<float> a_lengths)
+	{
+		unitize_all(a_points, a_lengths);
+	}
+
+	void Dot(std::span<const NiPoint3> a_lhs, std::span<const NiPoint3> a_rhs, std::span<float> a_out)
+	{
+		dot_all(a_lhs, a_rhs, a_out);
+	}
+
+	void Dot(ConstSoA a_lhs, ConstSoA a_rhs, std::span<float> a_out)
+	{
+		dot_all(a_lhs, a_rhs, a_out);
+	}
+
+	void Cross(std::span<const NiPoint3> a_lhs, std::span<const NiPoint3> a_rhs, std::span<NiPoint3> a_out)
+	{
+		cross_all(a_lhs, a_rhs, a_out);
+	}
+
+	void Cross(ConstSoA a_lhs, ConstSoA a_rhs, SoA a_out)
+	{
+		cross_all(a_lhs, a_rhs, a_out);
+	}
+
+	void EulerAnglesToAxesZXY(std::span<const NiPoint3> a_angles, std::span<NiMatrix3> a_out)
+	{
+		euler_all(a_angles, a_out);
+	}
+
+	void EulerAnglesToAxesZXY(ConstSoA a_angles, std::span<NiMatrix3> a_out)
+	{
+		euler_all(a_angles, a_out);
+	}
+}
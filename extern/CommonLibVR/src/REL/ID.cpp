@@ -2,9 +2,8 @@
 
 #include "REX/W32/KERNEL32.h"
 
-#ifdef ENABLE_SKYRIM_VR
-#	include <rapidcsv.h>
-#endif
+#include <charconv>
+#include <fstream>
 
 namespace REL
 {
@@ -89,35 +88,273 @@ namespace REL
 				_mapping = nullptr;
 			}
 		}
+
+		bool file_view::open(stl::zwstring a_filename)
+		{
+			close();
+
+			_file = REX::W32::CreateFileW(
+				a_filename.data(),
+				static_cast<std::uint32_t>(REX::W32::GENERIC_READ),
+				REX::W32::FILE_SHARE_READ,
+				nullptr,
+				REX::W32::OPEN_EXISTING,
+				REX::W32::FILE_ATTRIBUTE_NORMAL | REX::W32::FILE_FLAG_SEQUENTIAL_SCAN,
+				nullptr);
+			if (_file == REX::W32::INVALID_HANDLE_VALUE) {
+				_file = nullptr;
+				return false;
+			}
+
+			// an empty file cannot be mapped
+			REX::W32::LARGE_INTEGER size;
+			if (!REX::W32::GetFileSizeEx(_file, &size) || size.value <= 0) {
+				close();
+				return false;
+			}
+			_size = static_cast<std::size_t>(size.value);
+
+			_mapping = REX::W32::CreateFileMappingW(_file, nullptr, REX::W32::PAGE_READONLY, 0, 0, nullptr);
+			if (!_mapping) {
+				close();
+				return false;
+			}
+
+			_view = REX::W32::MapViewOfFile(_mapping, REX::W32::FILE_MAP_READ, 0, 0, 0);
+			if (!_view) {
+				close();
+				return false;
+			}
+
+			return true;
+		}
+
+		void file_view::close()
+		{
+			if (_view) {
+				REX::W32::UnmapViewOfFile(_view);
+				_view = nullptr;
+			}
+
+			if (_mapping) {
+				REX::W32::CloseHandle(_mapping);
+				_mapping = nullptr;
+			}
+
+			if (_file) {
+				REX::W32::CloseHandle(_file);
+				_file = nullptr;
+			}
+
+			_size = 0;
+		}
+	}
+
+#ifdef ENABLE_SKYRIM_VR
+	namespace
+	{
+		// next line of a_text without its line break
+		bool next_line(std::string_view& a_text, std::string_view& a_line) noexcept
+		{
+			if (a_text.empty()) {
+				return false;
+			}
+
+			const auto end = a_text.find('\n');
+			a_line = a_text.substr(0, end);
+			a_text.remove_prefix(end == std::string_view::npos ? a_text.size() : end + 1);
+			if (!a_line.empty() && a_line.back() == '\r') {
+				a_line.remove_suffix(1);
+			}
+			return true;
+		}
+
+		void skip_blanks(std::string_view& a_field) noexcept
+		{
+			while (!a_field.empty() && (a_field.front() == ' ' || a_field.front() == '\t')) {
+				a_field.remove_prefix(1);
+			}
+		}
+
+		// parses a number at the start of a_field and consumes it; like std::stoul,
+		// leading blanks and a 0x prefix on hex numbers are accepted
+		bool parse_number(std::string_view& a_field, int a_base, std::uint64_t& a_value) noexcept
+		{
+			skip_blanks(a_field);
+			if (a_base == 16 && a_field.size() > 2 && a_field[0] == '0' && (a_field[1] == 'x' || a_field[1] == 'X')) {
+				a_field.remove_prefix(2);
+			}
+
+			const auto [ptr, ec] = std::from_chars(a_field.data(), a_field.data() + a_field.size(), a_value, a_base);
+			if (ec != std::errc{}) {
+				return false;
+			}
+			a_field.remove_prefix(static_cast<std::size_t>(ptr - a_field.data()));
+			skip_blanks(a_field);
+			return true;
+		}
+	}
+#endif
+
+	namespace
+	{
+		// Non-cryptographic 64-bit hash; only has to notice a changed library or a
+		// damaged cache. Four independent lanes keep the multiplies pipelined.
+		std::uint64_t hash_bytes(const std::byte* a_data, std::size_t a_size, std::uint64_t a_seed = 0) noexcept
+		{
+			constexpr std::uint64_t k0 = 0x9E3779B97F4A7C15;
+			constexpr std::uint64_t k1 = 0xBF58476D1CE4E5B9;
+
+			const auto mix = [](std::uint64_t a_hash, std::uint64_t a_word) noexcept {
+				return std::rotl(a_hash ^ (a_word * k1), 29) * k0;
+			};
+
+			std::uint64_t lanes[4]{ a_seed ^ k0, a_seed ^ k1, a_seed + k0, a_seed - k1 };
+			std::size_t   i = 0;
+			for (; i + 32 <= a_size; i += 32) {
+				std::uint64_t words[4];
+				std::memcpy(words, a_data + i, sizeof(words));
+				for (std::size_t lane = 0; lane < 4; ++lane) {
+					lanes[lane] = mix(lanes[lane], words[lane]);
+				}
+			}
+
+			std::uint64_t hash = a_size * k0;
+			for (const auto lane : lanes) {
+				hash = mix(hash, lane);
+			}
+			for (; i < a_size; i += 8) {
+				std::uint64_t word = 0;
+				std::memcpy(&word, a_data + i, std::min<std::size_t>(8, a_size - i));
+				hash = mix(hash, word);
+			}
+			return hash ^ (hash >> 32);
+		}
+
+		// <library>.cache: this header, then the id-sorted table, then the offset-sorted one
+		struct cache_header_t
+		{
+			std::array<char, 8>          magic;
+			std::array<std::uint16_t, 4> version;
+			std::uint64_t                sourceSize;
+			std::uint64_t                sourceHash;
+			std::uint64_t                count;
+			std::uint64_t                checksum;  // of both tables
+		};
+		static_assert(sizeof(cache_header_t) == 0x30);
+
+		constexpr std::array<char, 8> cache_magic{ 'C', 'L', 'I', 'B', 'I', 'D', 'C', '1' };
+
+		std::wstring cache_path(stl::zwstring a_filename)
+		{
+			std::wstring path{ a_filename.data() };
+			path += L".cache"sv;
+			return path;
+		}
+
+		std::array<std::uint16_t, 4> version_array(const Version& a_version) noexcept
+		{
+			return { a_version[0], a_version[1], a_version[2], a_version[3] };
+		}
 	}
 
 	IDDatabase IDDatabase::_instance;
 
-	bool IDDatabase::load_file(stl::zwstring a_filename, Version a_version, std::uint8_t a_formatVersion, bool a_failOnError)
+	auto IDDatabase::make_cache_key(const detail::file_view& a_file, Version a_version) noexcept
+		-> cache_key_t
 	{
-		try {
-			istream_t in(a_filename.data(), std::ios::in | std::ios::binary);
-			header_t  header;
-			header.read(in, a_formatVersion);
-			if (header.version() != a_version) {
-				return stl::report_and_error("version mismatch"sv, a_failOnError);
-			}
-
-			auto mapname = L"CommonLibSSEOffsets-v2-"s;
-			mapname += a_version.wstring();
-			const auto byteSize = static_cast<std::size_t>(header.address_count()) * sizeof(mapping_t);
-			if (_mmap.open(mapname, byteSize)) {
-				_id2offset = { static_cast<mapping_t*>(_mmap.data()), header.address_count() };
-			} else if (_mmap.create(mapname, byteSize)) {
-				_id2offset = { static_cast<mapping_t*>(_mmap.data()), header.address_count() };
-				unpack_file(in, header, a_failOnError);
-				std::sort(_id2offset.begin(), _id2offset.end(), [](auto&& a_lhs, auto&& a_rhs) {
-					return a_lhs.id < a_rhs.id;
-				});
-			} else {
-				return stl::report_and_error("failed to create shared mapping"sv, a_failOnError);
+		return { a_version, a_file.size(), hash_bytes(a_file.data(), a_file.size()) };
+	}
+
+	auto IDDatabase::load_cache(stl::zwstring a_filename, const cache_key_t& a_key)
+		-> std::span<const mapping_t>
+	{
+		_cache.close();
+		_offset2id = {};
+
+		const auto count = _id2offset.size();
+		const auto tableSize = count * sizeof(mapping_t);
+		if (!_cache.open(cache_path(a_filename)) || _cache.size() != sizeof(cache_header_t) + 2 * tableSize) {
+			_cache.close();
+			return {};
+		}
+
+		cache_header_t header;
+		std::memcpy(&header, _cache.data(), sizeof(header));
+		const auto* tables = _cache.data() + sizeof(header);
+		if (header.magic != cache_magic ||
+			header.version != version_array(a_key.version) ||
+			header.sourceSize != a_key.size ||
+			header.sourceHash != a_key.hash ||
+			header.count != count ||
+			header.checksum != hash_bytes(tables, 2 * tableSize)) {
+			_cache.close();
+			return {};
+		}
+
+		const auto* mappings = reinterpret_cast<const mapping_t*>(tables);
+		_offset2id = { mappings + count, count };
+		return { mappings, count };
+	}
+
+	void IDDatabase::store_cache(stl::zwstring a_filename, const cache_key_t& a_key)
+	{
+		std::vector<mapping_t> offset2id(_id2offset.begin(), _id2offset.end());
+		const auto             byOffset = [](auto&& a_lhs, auto&& a_rhs) {
+			return a_lhs.offset < a_rhs.offset;
+		};
+		if (offset2id.size() >= parallel_sort_threshold) {
+			std::sort(std::execution::par_unseq, offset2id.begin(), offset2id.end(), byOffset);
+		} else {
+			std::sort(offset2id.begin(), offset2id.end(), byOffset);
+		}
+
+		// both tables are written back to back, so one hash over the mapped file matches
+		const auto tableSize = _id2offset.size() * sizeof(mapping_t);
+		std::vector<std::byte> tables(2 * tableSize);
+		std::memcpy(tables.data(), _id2offset.data(), tableSize);
+		std::memcpy(tables.data() + tableSize, offset2id.data(), tableSize);
+
+		const cache_header_t header{
+			cache_magic,
+			version_array(a_key.version),
+			a_key.size,
+			a_key.hash,
+			_id2offset.size(),
+			hash_bytes(tables.data(), tables.size())
+		};
+
+		// written aside and renamed into place so a reader never maps a partial file
+		const std::filesystem::path path{ cache_path(a_filename) };
+		auto                        staging = path;
+		staging += L".tmp"sv;
+		{
+			std::ofstream out(staging, std::ios::out | std::ios::binary | std::ios::trunc);
+			out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+			out.write(reinterpret_cast<const char*>(tables.data()), static_cast<std::streamsize>(tables.size()));
+			if (!out) {
+				out.close();
+				std::error_code ec;
+				std::filesystem::remove(staging, ec);
+				return;
 			}
-		} catch (const std::system_error&) {
+		}
+
+		_cache.close();
+		std::error_code ec;
+		std::filesystem::rename(staging, path, ec);
+		if (ec) {
+			std::filesystem::remove(staging, ec);
+			return;
+		}
+
+		load_cache(a_filename, a_key);
+	}
+
+	bool IDDatabase::load_file(stl::zwstring a_filename, Version a_version, std::uint8_t a_formatVersion, bool a_failOnError)
+	{
+		detail::file_view file;
+		if (!file.open(a_filename)) {
 			return stl::report_and_error(
 				std::format(
 					"Failed to locate an appropriate address library with the path: {}\n"
@@ -127,7 +364,140 @@ namespace REL
 					"address library has not yet added support for this version of the game."sv,
 					stl::utf16_to_utf8(a_filename).value_or("<unknown filename>"s)),
 				a_failOnError);
-			return false;
+		}
+
+		reader_t in(file.data(), file.size());
+		header_t header;
+		if (!header.read(in, a_formatVersion)) {
+			return stl::report_and_error("address library header is truncated"sv, a_failOnError);
+		}
+		if (header.version() != a_version) {
+			return stl::report_and_error("version mismatch"sv, a_failOnError);
+		}
+
+		// a valid cache replaces decoding the library and sorting its reverse table
+		const auto key = make_cache_key(file, a_version);
+		auto       mapname = L"CommonLibSSEOffsets-v2-"s;
+		mapname += a_version.wstring();
+		const auto byteSize = static_cast<std::size_t>(header.address_count()) * sizeof(mapping_t);
+		if (_mmap.open(mapname, byteSize)) {
+			_id2offset = { static_cast<mapping_t*>(_mmap.data()), header.address_count() };
+			load_cache(a_filename, key);
+		} else if (_mmap.create(mapname, byteSize)) {
+			_id2offset = { static_cast<mapping_t*>(_mmap.data()), header.address_count() };
+			if (const auto cached = load_cache(a_filename, key); !cached.empty()) {
+				std::copy(cached.begin(), cached.end(), _id2offset.begin());
+			} else if (unpack_file(in, header, a_failOnError)) {
+				store_cache(a_filename, key);
+			} else {
+				clear();
+				return false;
+			}
+		} else {
+			return stl::report_and_error("failed to create shared mapping"sv, a_failOnError);
+		}
+
+		return true;
+	}
+
+	bool IDDatabase::unpack_file(reader_t& a_in, header_t a_header, bool a_failOnError)
+	{
+		// Each entry is a type byte followed by the id and offset fields it describes.
+		// Both nibbles index the same encodings, so a field decodes as
+		// (relative ? prev : 0) +/- value + bias with the value read as one unaligned
+		// 8-byte load masked down to its width.
+		struct encoding_t
+		{
+			std::uint8_t size;
+			std::uint8_t relative;
+			std::uint8_t negate;
+			std::uint8_t bias;
+		};
+
+		static constexpr std::array<encoding_t, 8> encodings{ {
+			{ 8, 0, 0, 0 },  // absolute u64
+			{ 0, 1, 0, 1 },  // prev + 1
+			{ 1, 1, 0, 0 },  // prev + u8
+			{ 1, 1, 1, 0 },  // prev - u8
+			{ 2, 1, 0, 0 },  // prev + u16
+			{ 2, 1, 1, 0 },  // prev - u16
+			{ 2, 0, 0, 0 },  // absolute u16
+			{ 4, 0, 0, 0 },  // absolute u32
+		} };
+
+		static constexpr std::array<std::uint64_t, 9> masks{ 0, 0xFF, 0xFFFF, 0, 0xFFFFFFFF, 0, 0, 0, ~0ull };
+
+		const auto decode = [](encoding_t a_encoding, std::uint64_t a_prev, const std::byte* a_cur, const std::byte* a_end) noexcept {
+			std::uint64_t raw = 0;
+			if (a_end - a_cur >= static_cast<std::ptrdiff_t>(sizeof(raw))) [[likely]] {
+				std::memcpy(&raw, a_cur, sizeof(raw));
+			} else {
+				std::memcpy(&raw, a_cur, static_cast<std::size_t>(a_end - a_cur));
+			}
+			const auto value = raw & masks[a_encoding.size];
+			const auto negate = std::uint64_t{ 0 } - a_encoding.negate;
+			return (a_prev & (std::uint64_t{ 0 } - a_encoding.relative)) + ((value ^ negate) - negate) + a_encoding.bias;
+		};
+
+		// pointer sizes are powers of two in practice, which turns the scaling into shifts
+		const auto pointerSize = a_header.pointer_size();
+		const auto pointerShift = std::has_single_bit(pointerSize) ? std::countr_zero(pointerSize) : -1;
+
+		const std::byte* cur = a_in.data();
+		const std::byte* end = a_in.end();
+		std::uint64_t    prevID = 0;
+		std::uint64_t    prevOffset = 0;
+		bool             sorted = true;
+		for (auto& mapping : _id2offset) {
+			if (cur == end) {
+				return stl::report_and_error("address library file is truncated"sv, a_failOnError);
+			}
+
+			const auto type = std::to_integer<std::uint8_t>(*cur++);
+			const auto lo = static_cast<std::uint8_t>(type & 0xF);
+			const auto hi = static_cast<std::uint8_t>(type >> 4);
+			if (lo >= encodings.size()) {
+				return stl::report_and_error("unhandled type"sv, a_failOnError);
+			}
+
+			const auto idEncoding = encodings[lo];
+			const auto offsetEncoding = encodings[hi & 7];
+			if (static_cast<std::size_t>(end - cur) < static_cast<std::size_t>(idEncoding.size) + offsetEncoding.size) {
+				return stl::report_and_error("address library file is truncated"sv, a_failOnError);
+			}
+
+			const auto id = decode(idEncoding, prevID, cur, end);
+			cur += idEncoding.size;
+
+			const bool    scaled = (hi & 8) != 0;
+			std::uint64_t base = prevOffset;
+			if (scaled) {
+				base = pointerShift >= 0 ? prevOffset >> pointerShift : prevOffset / pointerSize;
+			}
+			auto offset = decode(offsetEncoding, base, cur, end);
+			cur += offsetEncoding.size;
+			if (scaled) {
+				offset = pointerShift >= 0 ? offset << pointerShift : offset * pointerSize;
+			}
+
+			mapping = { id, offset };
+
+			sorted = sorted && id >= prevID;
+			prevOffset = offset;
+			prevID = id;
+		}
+		a_in.seek(cur);
+
+		// the shipped databases are already in id order; otherwise sort, in parallel when it pays off
+		if (!sorted) {
+			const auto byID = [](auto&& a_lhs, auto&& a_rhs) {
+				return a_lhs.id < a_rhs.id;
+			};
+			if (_id2offset.size() >= parallel_sort_threshold) {
+				std::sort(std::execution::par_unseq, _id2offset.begin(), _id2offset.end(), byID);
+			} else {
+				std::sort(_id2offset.begin(), _id2offset.end(), byID);
+			}
 		}
 
 		return true;
@@ -143,14 +513,30 @@ namespace REL
 				a_failOnError);
 		}
 
-		rapidcsv::Document in(nstring);
-		std::size_t        id, address_count;
-		std::string        version, offset;
-		auto               mapname = L"CommonLibSSEOffsets-v2-"s;
-		mapname += a_version.wstring();
-		address_count = in.GetCell<std::size_t>(0, 0);
-		version = in.GetCell<std::string>(1, 0);
+		// parsed in place from the mapped file: no per-cell strings, no copies
+		detail::file_view file;
+		if (!file.open(a_filename)) {
+			return stl::report_and_error(
+				std::format("Failed to open VR Address Library file {}"sv, nstring),
+				a_failOnError);
+		}
+
+		// line 1 holds the column names, line 2 the entry count and library version
+		auto             text = file.str();
+		std::string_view line;
+		std::uint64_t    address_count = 0;
+		next_line(text, line);
+		if (!next_line(text, line) || !parse_number(line, 10, address_count) || !line.starts_with(',')) {
+			return stl::report_and_error(
+				std::format("VR Address Library file {} has no entry count and version. Please redownload."sv, nstring),
+				a_failOnError);
+		}
+		line.remove_prefix(1);
+		const auto version = line.substr(0, line.find(','));
 		_vrAddressLibraryVersion = Version(version);
+
+		auto mapname = L"CommonLibSSEOffsets-v2-"s;
+		mapname += a_version.wstring();
 		const auto byteSize = static_cast<std::size_t>(address_count * sizeof(mapping_t));
 		if (!_mmap.open(mapname, byteSize) &&
 			!_mmap.create(mapname, byteSize)) {
@@ -158,30 +544,63 @@ namespace REL
 		}
 
 		_id2offset = { static_cast<mapping_t*>(_mmap.data()), static_cast<std::size_t>(address_count) };
-		if (in.GetRowCount() > address_count + 1) {
-			return stl::report_and_error(
-				std::format("VR Address Library {} tried to exceed {} allocated entries."sv,
-					version, address_count),
-				a_failOnError);
-		} else if (in.GetRowCount() < address_count + 1) {
+
+		const auto key = make_cache_key(file, a_version);
+		if (const auto cached = load_cache(a_filename, key); !cached.empty()) {
+			std::copy(cached.begin(), cached.end(), _id2offset.begin());
+			return true;
+		}
+
+		// the sort is skipped when the ids are already in order, checked while parsing
+		std::size_t   entries = 0;
+		std::size_t   lineNumber = 2;
+		std::uint64_t prevID = 0;
+		bool          sorted = true;
+		while (next_line(text, line)) {
+			++lineNumber;
+			if (line.empty()) {
+				continue;
+			}
+			if (entries == _id2offset.size()) {
+				return stl::report_and_error(
+					std::format("VR Address Library {} tried to exceed {} allocated entries."sv,
+						version, address_count),
+					a_failOnError);
+			}
+
+			std::uint64_t id = 0;
+			std::uint64_t offset = 0;
+			bool          valid = parse_number(line, 10, id) && line.starts_with(',');
+			if (valid) {
+				line.remove_prefix(1);
+				valid = parse_number(line, 16, offset) && line.empty();
+			}
+			if (!valid) {
+				return stl::report_and_error(
+					std::format("VR Address Library {} has a malformed entry on line {}. Please redownload."sv,
+						version, lineNumber),
+					a_failOnError);
+			}
+
+			_id2offset[entries++] = { id, offset };
+			sorted = sorted && id >= prevID;
+			prevID = id;
+		}
+
+		if (entries < _id2offset.size()) {
 			return stl::report_and_error(
 				std::format("VR Address Library {} loaded only {} entries but expected {}. Please redownload."sv,
-					version, in.GetRowCount() - 1, address_count),
+					version, entries, address_count),
 				a_failOnError);
 		}
 
-		std::size_t index = 1;
-		for (; index < in.GetRowCount(); ++index) {
-			id = in.GetCell<std::size_t>(0, index);
-			offset = in.GetCell<std::string>(1, index);
-			_id2offset[index - 1] = { static_cast<std::uint64_t>(id),
-				static_cast<std::uint64_t>(std::stoul(offset, nullptr, 16)) };
+		if (!sorted) {
+			std::sort(_id2offset.begin(), _id2offset.end(), [](auto&& a_lhs, auto&& a_rhs) {
+				return a_lhs.id < a_rhs.id;
+			});
 		}
 
-		std::sort(_id2offset.begin(), _id2offset.end(), [](auto&& a_lhs, auto&& a_rhs) {
-			return a_lhs.id < a_rhs.id;
-		});
-
+		store_cache(a_filename, key);
 		return true;
 	}
 
@@ -21,10 +21,11 @@ namespace SKSE
 			_handles = a_rhs._handles;
 			a_rhs._lock.unlock();
 
-			auto vm = RE::BSScript::Internal::VirtualMachine::GetSingleton();
-			auto policy = vm ? vm->GetObjectHandlePolicy() : nullptr;
-			if (policy) {
-				for (auto& handle : _handles) {
+			auto       vm = RE::BSScript::Internal::VirtualMachine::GetSingleton();
+			auto       policy = vm ? vm->GetObjectHandlePolicy() : nullptr;
+			const auto handles = _handles.snapshot();
+			if (policy && handles) {
+				for (const auto handle : *handles) {
 					policy->PersistHandle(handle);
 				}
 			}
@@ -37,15 +38,15 @@ namespace SKSE
 		{
 			Locker locker(a_rhs._lock);
 			_handles = std::move(a_rhs._handles);
-			a_rhs._handles.clear();
 		}
 
 		RegistrationSetBase::~RegistrationSetBase()
 		{
-			auto vm = RE::BSScript::Internal::VirtualMachine::GetSingleton();
-			auto policy = vm ? vm->GetObjectHandlePolicy() : nullptr;
-			if (policy) {
-				for (auto& handle : _handles) {
+			auto       vm = RE::BSScript::Internal::VirtualMachine::GetSingleton();
+			auto       policy = vm ? vm->GetObjectHandlePolicy() : nullptr;
+			const auto handles = _handles.snapshot();
+			if (policy && handles) {
+				for (const auto handle : *handles) {
 					policy->ReleaseHandle(handle);
 				}
 			}
@@ -66,10 +67,11 @@ namespace SKSE
 				_eventName = a_rhs._eventName;
 			}
 
-			auto vm = RE::BSScript::Internal::VirtualMachine::GetSingleton();
-			auto policy = vm ? vm->GetObjectHandlePolicy() : nullptr;
-			if (policy) {
-				for (auto& handle : _handles) {
+			auto       vm = RE::BSScript::Internal::VirtualMachine::GetSingleton();
+			auto       policy = vm ? vm->GetObjectHandlePolicy() : nullptr;
+			const auto handles = _handles.snapshot();
+			if (policy && handles) {
+				for (const auto handle : *handles) {
 					policy->PersistHandle(handle);
 				}
 			}
@@ -91,7 +93,6 @@ namespace SKSE
 			_eventName = a_rhs._eventName;
 
 			_handles = std::move(a_rhs._handles);
-			a_rhs._handles.clear();
 
 			return *this;
 		}
@@ -134,11 +135,12 @@ namespace SKSE
 
 		void RegistrationSetBase::Clear()
 		{
-			auto   vm = RE::BSScript::Internal::VirtualMachine::GetSingleton();
-			auto   policy = vm ? vm->GetObjectHandlePolicy() : nullptr;
-			Locker locker(_lock);
-			if (policy) {
-				for (auto& handle : _handles) {
+			auto       vm = RE::BSScript::Internal::VirtualMachine::GetSingleton();
+			auto       policy = vm ? vm->GetObjectHandlePolicy() : nullptr;
+			Locker     locker(_lock);
+			const auto handles = _handles.snapshot();
+			if (policy && handles) {
+				for (const auto handle : *handles) {
 					policy->ReleaseHandle(handle);
 				}
 			}
@@ -159,14 +161,18 @@ namespace SKSE
 		bool RegistrationSetBase::Save(SerializationInterface* a_intfc)
 		{
 			assert(a_intfc);
-			Locker            locker(_lock);
-			const std::size_t numRegs = _handles.size();
+			const auto        handles = _handles.snapshot();
+			const std::size_t numRegs = handles ? handles->size() : 0;
 			if (!a_intfc->WriteRecordData(numRegs)) {
 				log::error("Failed to save number of regs ({})", numRegs);
 				return false;
 			}
 
-			for (auto& handle : _handles) {
+			if (!handles) {
+				return true;
+			}
+
+			for (const auto handle : *handles) {
 				if (!a_intfc->WriteRecordData(handle)) {
 					log::error("Failed to save reg ({})", handle);
 					return false;
@@ -182,17 +188,19 @@ namespace SKSE
 			std::size_t numRegs;
 			a_intfc->ReadRecordData(numRegs);
 
-			Locker locker(_lock);
-			_handles.clear();
+			FlatHandleSet::container_type loaded;
 
 			RE::VMHandle handle;
 			for (std::size_t i = 0; i < numRegs; ++i) {
 				a_intfc->ReadRecordData(handle);
 				if (a_intfc->ResolveHandle(handle, handle)) {
-					_handles.insert(handle);
+					loaded.push_back(handle);
 				}
 			}
 
+			Locker locker(_lock);
+			_handles.assign(std::move(loaded));
+
 			return true;
 		}
 
@@ -219,14 +227,14 @@ namespace SKSE
 			}
 
 			_lock.lock();
-			auto result = _handles.insert(handle);
+			const auto inserted = _handles.insert(handle);
 			_lock.unlock();
 
-			if (result.second) {
+			if (inserted) {
 				policy->PersistHandle(handle);
 			}
 
-			return result.second;
+			return inserted;
 		}
 
 		bool RegistrationSetBase::Unregister(const void* a_object, RE::VMTypeID a_typeID)
@@ -247,12 +255,10 @@ namespace SKSE
 			}
 
 			Locker locker(_lock);
-			auto   it = _handles.find(handle);
-			if (it == _handles.end()) {
+			if (!_handles.erase(handle)) {
 				return false;
 			} else {
-				policy->ReleaseHandle(*it);
-				_handles.erase(it);
+				policy->ReleaseHandle(handle);
 				return true;
 			}
 		}
@@ -267,12 +273,10 @@ namespace SKSE
 			}
 
 			Locker locker(_lock);
-			auto   it = _handles.find(a_handle);
-			if (it == _handles.end()) {
+			if (!_handles.erase(a_handle)) {
 				return false;
 			} else {
-				policy->ReleaseHandle(*it);
-				_handles.erase(it);
+				policy->ReleaseHandle(a_handle);
 				return true;
 			}
 		}
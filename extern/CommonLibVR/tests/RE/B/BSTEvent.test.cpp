@@ -0,0 +1,91 @@
+#include "catch2/catch_all.hpp"
+
+#include "RE/B/BSTEvent.h"
+
+namespace
+{
+	struct TestEvent
+	{};
+
+	class CountingSink : public RE::BSTEventSink<TestEvent>
+	{
+	public:
+		RE::BSEventNotifyControl ProcessEvent(const TestEvent*, RE::BSTEventSource<TestEvent>*) override
+		{
+			++count;
+			return RE::BSEventNotifyControl::kContinue;
+		}
+
+		// members
+		int count{ 0 };
+	};
+}
+
+TEST_CASE("BSTEvent/ScopedSink", "[.][e2e]")
+{
+	// BSTArray allocates from the game's heap
+	REQUIRE(REL::Module::inject());
+	{
+		RE::BSTEventSource<TestEvent> first;
+		RE::BSTEventSource<TestEvent> second;
+		CountingSink                  a;
+		CountingSink                  b;
+		CountingSink                  c;
+		const TestEvent               event;
+
+		SECTION("Registration is idempotent and follows the source")
+		{
+			RE::ScopedSink<TestEvent> scoped(&a);
+			CHECK_FALSE(scoped.registered());
+			CHECK(scoped.Register(&first));
+			CHECK_FALSE(scoped.Register(&first));
+			CHECK(first.sinks.size() == 1);
+			CHECK(scoped.source() == &first);
+
+			CHECK(scoped.Register(&second));
+			CHECK(first.sinks.empty());
+			second.SendEvent(&event);
+			CHECK(a.count == 1);
+
+			CHECK(scoped.Unregister());
+			CHECK_FALSE(scoped.Unregister());
+			CHECK(second.sinks.empty());
+		}
+
+		SECTION("Destruction unregisters unless released")
+		{
+			{
+				RE::ScopedSink<TestEvent> kept(&a, &first);
+				RE::ScopedSink<TestEvent> dropped(&b, &first);
+				CHECK(kept.release() == &first);
+			}
+			REQUIRE(first.sinks.size() == 1);
+			CHECK(first.sinks[0] == &a);
+		}
+
+		SECTION("Moves carry the registration")
+		{
+			RE::ScopedSink<TestEvent> from(&a, &first);
+			RE::ScopedSink<TestEvent> to(std::move(from));
+			CHECK_FALSE(from.registered());
+			CHECK(to.source() == &first);
+			CHECK(first.sinks.size() == 1);
+		}
+
+		SECTION("RegisterAll adds only the sinks not already on the source")
+		{
+			RE::ScopedSink<TestEvent> x(&a, &second);
+			RE::ScopedSink<TestEvent> y(&b, &first);
+			RE::ScopedSink<TestEvent> z(&c);
+			CHECK(RE::ScopedSink<TestEvent>::RegisterAll(&first, x, y, z) == 2);
+			CHECK(RE::ScopedSink<TestEvent>::RegisterAll(&first, x, y, z) == 0);
+			CHECK(second.sinks.empty());
+
+			first.SendEvent(&event);
+			CHECK(a.count == 1);
+			CHECK(b.count == 1);
+			CHECK(c.count == 1);
+		}
+	}
+	REL::Module::reset();
+}
@@ -0,0 +1,260 @@
+#include "catch2/catch_all.hpp"
+
+#include "RE/N/NiBatch.h"
+#include "RE/N/NiMath.h"
+
+namespace
+{
+	using RE::NiBatch::SimdLevel;
+
+	// 37 keeps every level's scalar tail in play
+	constexpr std::size_t PointCount = 37;
+
+	std::vector<RE::NiPoint3> make_points(std::uint32_t a_seed, float a_scale)
+	{
+		std::mt19937                          rng(a_seed);
+		std::uniform_real_distribution<float> dist(-a_scale, a_scale);
+
+		std::vector<RE::NiPoint3> points(PointCount);
+		for (auto& point : points) {
+			point = { dist(rng), dist(rng), dist(rng) };
+		}
+		// the Unitize edge cases
+		points[3] = { 0.0F, 0.0F, 0.0F };
+		points[4] = { 1.0F, 0.0F, 0.0F };
+		points[5] = { 1e-8F, 0.0F, 0.0F };
+		return points;
+	}
+
+	struct SoAPoints
+	{
+		explicit SoAPoints(std::span<const RE::NiPoint3> a_points)
+		{
+			for (const auto& point : a_points) {
+				x.push_back(point.x);
+				y.push_back(point.y);
+				z.push_back(point.z);
+			}
+		}
+
+		RE::NiBatch::SoA span() { return { x, y, z }; }
+
+		[[nodiscard]] RE::NiPoint3 operator[](std::size_t a_idx) const { return { x[a_idx], y[a_idx], z[a_idx] }; }
+
+		// members
+		std::vector<float> x;
+		std::vector<float> y;
+		std::vector<float> z;
+	};
+
+	void check_close(float a_actual, float a_expected, float a_tolerance)
+	{
+		CHECK_THAT(a_actual, Catch::Matchers::WithinAbs(a_expected, a_tolerance));
+	}
+
+	void check_close(const RE::NiPoint3& a_actual, const RE::NiPoint3& a_expected, float a_tolerance)
+	{
+		for (std::size_t i = 0; i < 3; ++i) {
+			check_close(a_actual[i], a_expected[i], a_tolerance);
+		}
+	}
+
+	// Runs a_test once at every level this CPU supports
+	template <class F>
+	void for_each_level(F&& a_test)
+	{
+		const auto supported = RE::NiBatch::GetSupportedSimdLevel();
+		for (const auto level : { SimdLevel::kScalar, SimdLevel::kSSE41, SimdLevel::kAVX2 }) {
+			if (level <= supported) {
+				REQUIRE(RE::NiBatch::SetSimdLevel(level) == level);
+				DYNAMIC_SECTION("SIMD level " << static_cast<int>(level))
+				{
+					a_test();
+				}
+			}
+		}
+		RE::NiBatch::SetSimdLevel(supported);
+	}
+}
+
+TEST_CASE("NiBatch/SetSimdLevel")
+{
+	const auto supported = RE::NiBatch::GetSupportedSimdLevel();
+	CHECK(RE::NiBatch::GetSimdLevel() == supported);
+	CHECK(RE::NiBatch::SetSimdLevel(SimdLevel::kScalar) == SimdLevel::kScalar);
+	CHECK(RE::NiBatch::GetSimdLevel() == SimdLevel::kScalar);
+	CHECK(RE::NiBatch::SetSimdLevel(SimdLevel::kAVX2) == supported);
+	CHECK(RE::NiBatch::GetSimdLevel() == supported);
+}
+
+TEST_CASE("NiBatch/Transform")
+{
+	RE::NiMatrix3 matrix;
+	matrix.EulerAnglesToAxesZXY(0.3F, -1.1F, 2.4F);
+	const auto points = make_points(1, 4096.0F);
+
+	for_each_level([&] {
+		std::vector<RE::NiPoint3> aos(points.size());
+		RE::NiBatch::Transform(matrix, points, aos);
+
+		SoAPoints soa(points);
+		RE::NiBatch::Transform(matrix, soa.span(), soa.span());
+
+		for (std::size_t i = 0; i < points.size(); ++i) {
+			const auto expected = matrix * points[i];
+			check_close(aos[i], expected, 1e-3F);
+			check_close(soa[i], expected, 1e-3F);
+		}
+	});
+}
+
+TEST_CASE("NiBatch/Unitize")
+{
+	const auto points = make_points(2, 100.0F);
+
+	for_each_level([&] {
+		auto               aos = points;
+		std::vector<float> lengths(points.size());
+		RE::NiBatch::Unitize(aos, lengths);
+
+		SoAPoints soa(points);
+		RE::NiBatch::Unitize(soa.span());
+
+		for (std::size_t i = 0; i < points.size(); ++i) {
+			auto       expected = points[i];
+			const auto length = expected.Unitize();
+			check_close(lengths[i], length, 1e-5F);
+			check_close(aos[i], expected, 1e-6F);
+			check_close(soa[i], expected, 1e-6F);
+		}
+		CHECK(aos[3] == RE::NiPoint3(0.0F, 0.0F, 0.0F));
+		CHECK(aos[4] == RE::NiPoint3(1.0F, 0.0F, 0.0F));
+		CHECK(aos[5] == RE::NiPoint3(0.0F, 0.0F, 0.0F));
+		CHECK(lengths[5] == 0.0F);
+	});
+}
+
+TEST_CASE("NiBatch/DotAndCross")
+{
+	const auto lhs = make_points(3, 10.0F);
+	const auto rhs = make_points(4, 10.0F);
+
+	for_each_level([&] {
+		std::vector<float>        dots(lhs.size());
+		std::vector<RE::NiPoint3> crosses(lhs.size());
+		RE::NiBatch::Dot(lhs, rhs, dots);
+		RE::NiBatch::Cross(lhs, rhs, crosses);
+
+		SoAPoints          soaLhs(lhs);
+		SoAPoints          soaRhs(rhs);
+		std::vector<float> soaDots(lhs.size());
+		RE::NiBatch::Dot(soaLhs.span(), soaRhs.span(), soaDots);
+		RE::NiBatch::Cross(soaLhs.span(), soaRhs.span(), soaLhs.span());
+
+		for (std::size_t i = 0; i < lhs.size(); ++i) {
+			check_close(dots[i], lhs[i].Dot(rhs[i]), 1e-4F);
+			check_close(soaDots[i], lhs[i].Dot(rhs[i]), 1e-4F);
+			check_close(crosses[i], lhs[i].Cross(rhs[i]), 1e-4F);
+			check_close(soaLhs[i], lhs[i].Cross(rhs[i]), 1e-4F);
+		}
+	});
+}
+
+TEST_CASE("NiBatch/EulerAnglesToAxesZXY")
+{
+	// whole turns either way, plus exact quadrant boundaries
+	auto angles = make_points(5, 4.0F * RE::NI_PI);
+	angles[0] = { 0.0F, RE::NI_HALF_PI, RE::NI_PI };
+	angles[1] = { -RE::NI_HALF_PI, -RE::NI_PI, RE::NI_TWO_PI };
+
+	for_each_level([&] {
+		std::vector<RE::NiMatrix3> aos(angles.size());
+		RE::NiBatch::EulerAnglesToAxesZXY(angles, aos);
+
+		SoAPoints                  soa(angles);
+		std::vector<RE::NiMatrix3> fromSoA(angles.size());
+		RE::NiBatch::EulerAnglesToAxesZXY(soa.span(), fromSoA);
+
+		for (std::size_t i = 0; i < angles.size(); ++i) {
+			RE::NiMatrix3 expected;
+			expected.EulerAnglesToAxesZXY(angles[i]);
+			for (std::size_t row = 0; row < 3; ++row) {
+				for (std::size_t col = 0; col < 3; ++col) {
+					check_close(aos[i].entry[row][col], expected.entry[row][col], 1e-6F);
+					check_close(fromSoA[i].entry[row][col], expected.entry[row][col], 1e-6F);
+				}
+			}
+		}
+	});
+}
+
+TEST_CASE("NiBatch/Benchmark", "[!benchmark]")
+{
+	constexpr std::size_t count = 4096;
+
+	std::mt19937                          rng(6);
+	std::uniform_real_distribution<float> dist(-RE::NI_PI, RE::NI_PI);
+	std::vector<RE::NiPoint3>             points(count);
+	for (auto& point : points) {
+		point = { dist(rng), dist(rng), dist(rng) };
+	}
+	SoAPoints                  soa(points);
+	std::vector<RE::NiPoint3>  out(count);
+	std::vector<RE::NiMatrix3> matrices(count);
+	RE::NiMatrix3              matrix(0.3F, -1.1F, 2.4F);
+
+	BENCHMARK("NiMatrix3 * NiPoint3")
+	{
+		for (std::size_t i = 0; i < count; ++i) {
+			out[i] = matrix * points[i];
+		}
+		return out.back().x;
+	};
+	BENCHMARK("NiPoint3::Unitize")
+	{
+		for (std::size_t i = 0; i < count; ++i) {
+			out[i] = points[i];
+			out[i].Unitize();
+		}
+		return out.back().x;
+	};
+	BENCHMARK("NiMatrix3::EulerAnglesToAxesZXY")
+	{
+		for (std::size_t i = 0; i < count; ++i) {
+			matrices[i].EulerAnglesToAxesZXY(points[i]);
+		}
+		return matrices.back().entry[0][0];
+	};
+
+	const auto supported = RE::NiBatch::GetSupportedSimdLevel();
+	for (const auto level : { SimdLevel::kScalar, SimdLevel::kSSE41, SimdLevel::kAVX2 }) {
+		if (level > supported) {
+			continue;
+		}
+		RE::NiBatch::SetSimdLevel(level);
+
+		const auto suffix = " (level " + std::to_string(static_cast<int>(level)) + ")";
+		BENCHMARK("NiBatch::Transform AoS" + suffix)
+		{
+			RE::NiBatch::Transform(matrix, points, out);
+			return out.back().x;
+		};
+		BENCHMARK("NiBatch::Transform SoA" + suffix)
+		{
+			RE::NiBatch::Transform(matrix, soa.span(), soa.span());
+			return soa.x.back();
+		};
+		BENCHMARK("NiBatch::Unitize AoS" + suffix)
+		{
+			std::copy(points.begin(), points.end(), out.begin());
+			RE::NiBatch::Unitize(out);
+			return out.back().x;
+		};
+		BENCHMARK("NiBatch::EulerAnglesToAxesZXY AoS" + suffix)
+		{
+			RE::NiBatch::EulerAnglesToAxesZXY(points, matrices);
+			return matrices.back().entry[0][0];
+		};
+	}
+	RE::NiBatch::SetSimdLevel(supported);
+}
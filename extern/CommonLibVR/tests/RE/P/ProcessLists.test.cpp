@@ -0,0 +1,108 @@
+#include "catch2/catch_all.hpp"
+
+#include "RE/A/Actor.h"
+#include "RE/P/ProcessLists.h"
+#include "RE/T/TempEffectTraits.h"
+
+namespace
+{
+	using Callback = std::function<RE::BSContainer::ForEachResult(RE::Actor*)>;
+
+	std::vector<RE::Actor*> CollectWithFunction(RE::ProcessLists* a_processLists, std::size_t a_limit)
+	{
+		std::vector<RE::Actor*> actors;
+		Callback                callback = [&](RE::Actor* a_actor) {
+			actors.push_back(a_actor);
+			return actors.size() < a_limit ? RE::BSContainer::ForEachResult::kContinue : RE::BSContainer::ForEachResult::kStop;
+		};
+		a_processLists->ForAllActors(callback);
+		return actors;
+	}
+
+	std::vector<RE::Actor*> CollectInlined(RE::ProcessLists* a_processLists, std::size_t a_limit)
+	{
+		std::vector<RE::Actor*> actors;
+		a_processLists->ForAllActors([&](RE::Actor* a_actor) {
+			actors.push_back(a_actor);
+			return actors.size() < a_limit ? RE::BSContainer::ForEachResult::kContinue : RE::BSContainer::ForEachResult::kStop;
+		});
+		return actors;
+	}
+}
+
+// Needs a running game with a loaded save; the singleton is null otherwise
+TEST_CASE("ProcessLists/ForEach", "[.][e2e]")
+{
+	const auto processLists = RE::ProcessLists::GetSingleton();
+	if (!processLists) {
+		SKIP("ProcessLists is not initialised");
+	}
+
+	SECTION("Inlined overloads visit the same actors")
+	{
+		const auto all = std::numeric_limits<std::size_t>::max();
+		CHECK(CollectInlined(processLists, all) == CollectWithFunction(processLists, all));
+	}
+	SECTION("Early exit stops at the same actor")
+	{
+		CHECK(CollectInlined(processLists, 3) == CollectWithFunction(processLists, 3));
+	}
+	SECTION("High actors")
+	{
+		std::vector<RE::Actor*> fromFunction;
+		std::vector<RE::Actor*> fromInlined;
+		Callback                callback = [&](RE::Actor* a_actor) {
+			fromFunction.push_back(a_actor);
+			return RE::BSContainer::ForEachResult::kContinue;
+		};
+		processLists->ForEachHighActor(callback);
+		processLists->ForEachHighActor([&](RE::Actor* a_actor) {
+			fromInlined.push_back(a_actor);
+			return RE::BSContainer::ForEachResult::kContinue;
+		});
+		CHECK(fromInlined == fromFunction);
+	}
+	SECTION("Magic effects")
+	{
+		std::size_t fromFunction = 0;
+		std::size_t fromInlined = 0;
+		std::function<RE::BSContainer::ForEachResult(RE::ModelReferenceEffect*)> callback = [&](RE::ModelReferenceEffect*) {
+			++fromFunction;
+			return RE::BSContainer::ForEachResult::kContinue;
+		};
+		processLists->ForEachModelEffect(callback);
+		processLists->ForEachModelEffect([&](RE::ModelReferenceEffect*) {
+			++fromInlined;
+			return RE::BSContainer::ForEachResult::kContinue;
+		});
+		CHECK(fromInlined == fromFunction);
+	}
+}
+
+TEST_CASE("ProcessLists/ForEach/Benchmark", "[.][e2e][!benchmark]")
+{
+	const auto processLists = RE::ProcessLists::GetSingleton();
+	if (!processLists) {
+		SKIP("ProcessLists is not initialised");
+	}
+
+	BENCHMARK("ForAllActors std::function")
+	{
+		float    sum = 0.0f;
+		Callback callback = [&](RE::Actor* a_actor) {
+			sum += a_actor->GetPositionX();
+			return RE::BSContainer::ForEachResult::kContinue;
+		};
+		processLists->ForAllActors(callback);
+		return sum;
+	};
+	BENCHMARK("ForAllActors inlined")
+	{
+		float sum = 0.0f;
+		processLists->ForAllActors([&](RE::Actor* a_actor) {
+			sum += a_actor->GetPositionX();
+			return RE::BSContainer::ForEachResult::kContinue;
+		});
+		return sum;
+	};
+}
@@ -0,0 +1,304 @@
+#include "catch2/catch_all.hpp"
+
+#include "REL/REL.h"
+#include "SKSE/SKSE.h"
+
+namespace
+{
+	std::vector<char> read_file(const std::filesystem::path& a_path)
+	{
+		std::ifstream in(a_path, std::ios::in | std::ios::binary);
+		return { std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>() };
+	}
+
+	// the cache sits next to the library, which here is a checked-in fixture;
+	// unmaps it and deletes it however the test exits so the next run starts
+	// cold and the source tree stays clean
+	struct scoped_cache
+	{
+		explicit scoped_cache(std::filesystem::path a_path) :
+			path(std::move(a_path))
+		{
+			std::filesystem::remove(path);
+		}
+
+		scoped_cache(const scoped_cache&) = delete;
+		scoped_cache& operator=(const scoped_cache&) = delete;
+
+		~scoped_cache()
+		{
+			REL::Module::reset();
+			std::error_code ec;
+			std::filesystem::remove(path, ec);
+		}
+
+		std::filesystem::path path;
+	};
+
+	// a cold load writes <library>.cache, a warm load serves both tables from it,
+	// and a damaged cache is rejected and rewritten
+	void check_cache_round_trip(
+		const char* a_path, const wchar_t* a_injectPath, REL::IDDatabase::Format a_format, REL::Version a_version,
+		REL::Module::Runtime a_runtime, const wchar_t* a_executable)
+	{
+		const auto same = [](auto&& a_lhs, auto&& a_rhs) {
+			return a_lhs.id == a_rhs.id && a_lhs.offset == a_rhs.offset;
+		};
+
+		const scoped_cache           guard{ std::string(a_path) + ".cache" };
+		const std::filesystem::path& cache = guard.path;
+		REQUIRE(REL::Module::mock(a_version, a_runtime, a_executable, 0x1000));
+
+		REQUIRE(REL::IDDatabase::inject(a_injectPath, a_format, a_version));
+		REQUIRE(std::filesystem::exists(cache));
+		const REL::IDDatabase::Offset2ID cold;
+		const auto                       written = read_file(cache);
+		REQUIRE(cold.size() > 0);
+		CHECK(std::is_sorted(cold.begin(), cold.end(), [](auto&& a_lhs, auto&& a_rhs) {
+			return a_lhs.offset < a_rhs.offset;
+		}));
+
+		REQUIRE(REL::IDDatabase::inject(a_injectPath, a_format, a_version));
+		const REL::IDDatabase::Offset2ID warm;
+		CHECK(std::equal(cold.begin(), cold.end(), warm.begin(), warm.end(), same));
+		for (const auto& mapping : cold) {
+			REQUIRE(REL::IDDatabase::get().id2offset(mapping.id) == mapping.offset);
+		}
+
+		// the database keeps the cache mapped until it is reset
+		REL::Module::reset();
+		REQUIRE(REL::Module::mock(a_version, a_runtime, a_executable, 0x1000));
+		{
+			std::fstream file(cache, std::ios::in | std::ios::out | std::ios::binary);
+			file.seekp(-1, std::ios::end);
+			file.put(static_cast<char>(written.back() ^ 0x5A));
+		}
+		REQUIRE(REL::IDDatabase::inject(a_injectPath, a_format, a_version));
+		const REL::IDDatabase::Offset2ID rebuilt;
+		CHECK(std::equal(cold.begin(), cold.end(), rebuilt.begin(), rebuilt.end(), same));
+		CHECK(read_file(cache) == written);
+	}
+}
+
+#if defined(ENABLE_SKYRIM_SE) || defined(ENABLE_SKYRIM_AE)
+namespace
+{
+	// the stream based decoder the in-memory one replaced, kept as the reference;
+	// returns the entries in file order, or an empty vector on a bad type byte
+	std::vector<std::pair<std::uint64_t, std::uint64_t>> load_with_ifstream(const char* a_path)
+	{
+		std::ifstream in(a_path, std::ios::in | std::ios::binary);
+		const auto    read = [&]<class T>(T a_val) {
+			in.read(reinterpret_cast<char*>(std::addressof(a_val)), sizeof(T));
+			return static_cast<std::uint64_t>(a_val);
+		};
+
+		std::int32_t header[6]{};
+		in.read(reinterpret_cast<char*>(header), sizeof(header));
+		in.ignore(header[5]);
+		const auto pointerSize = read(std::int32_t{});
+		const auto count = read(std::int32_t{});
+
+		std::vector<std::pair<std::uint64_t, std::uint64_t>> entries;
+		entries.reserve(count);
+		std::uint64_t prevID = 0;
+		std::uint64_t prevOffset = 0;
+		for (std::uint64_t i = 0; i < count; ++i) {
+			const auto    type = read(std::uint8_t{});
+			const auto    hi = type >> 4;
+			std::uint64_t id = 0;
+			switch (type & 0xF) {
+			case 0:
+				id = read(std::uint64_t{});
+				break;
+			case 1:
+				id = prevID + 1;
+				break;
+			case 2:
+				id = prevID + read(std::uint8_t{});
+				break;
+			case 3:
+				id = prevID - read(std::uint8_t{});
+				break;
+			case 4:
+				id = prevID + read(std::uint16_t{});
+				break;
+			case 5:
+				id = prevID - read(std::uint16_t{});
+				break;
+			case 6:
+				id = read(std::uint16_t{});
+				break;
+			case 7:
+				id = read(std::uint32_t{});
+				break;
+			default:
+				return {};
+			}
+
+			const auto    tmp = (hi & 8) != 0 ? prevOffset / pointerSize : prevOffset;
+			std::uint64_t offset = 0;
+			switch (hi & 7) {
+			case 0:
+				offset = read(std::uint64_t{});
+				break;
+			case 1:
+				offset = tmp + 1;
+				break;
+			case 2:
+				offset = tmp + read(std::uint8_t{});
+				break;
+			case 3:
+				offset = tmp - read(std::uint8_t{});
+				break;
+			case 4:
+				offset = tmp + read(std::uint16_t{});
+				break;
+			case 5:
+				offset = tmp - read(std::uint16_t{});
+				break;
+			case 6:
+				offset = read(std::uint16_t{});
+				break;
+			case 7:
+				offset = read(std::uint32_t{});
+				break;
+			}
+			if ((hi & 8) != 0) {
+				offset *= pointerSize;
+			}
+
+			entries.emplace_back(id, offset);
+			prevID = id;
+			prevOffset = offset;
+		}
+		return entries;
+	}
+
+	void check_matches_reference(const char* a_path, const wchar_t* a_injectPath, REL::IDDatabase::Format a_format, REL::Version a_version)
+	{
+		const auto expected = load_with_ifstream(a_path);
+		REQUIRE(!expected.empty());
+
+		REQUIRE(REL::IDDatabase::inject(a_injectPath, a_format, a_version));
+		const auto& db = REL::IDDatabase::get();
+		for (const auto& [id, offset] : expected) {
+			REQUIRE(db.id2offset(id) == offset);
+		}
+		CHECK(REL::IDDatabase::Offset2ID().size() == expected.size());
+	}
+}
+#endif
+
+#ifdef ENABLE_SKYRIM_SE
+TEST_CASE("IDDatabase/BinaryLoaderMatchesStreamSE")
+{
+	REQUIRE(REL::Module::mock(SKSE::RUNTIME_SSE_1_5_97, REL::Module::Runtime::SE, L"SkyrimSE.exe", 0x1000));
+	check_matches_reference(
+		"Data/SKSE/Plugins/version-1-5-97-0.bin",
+		L"Data\\SKSE\\Plugins\\version-1-5-97-0.bin", REL::IDDatabase::Format::SSEv1, SKSE::RUNTIME_SSE_1_5_97);
+	REL::Module::reset();
+}
+#endif
+
+#ifdef ENABLE_SKYRIM_AE
+TEST_CASE("IDDatabase/BinaryLoaderMatchesStreamAE")
+{
+	REQUIRE(REL::Module::mock(SKSE::RUNTIME_SSE_1_6_353, REL::Module::Runtime::AE, L"SkyrimSE.exe", 0x1000));
+	check_matches_reference(
+		"Data/SKSE/Plugins/versionlib-1-6-353-0.bin",
+		L"Data\\SKSE\\Plugins\\versionlib-1-6-353-0.bin", REL::IDDatabase::Format::SSEv2, SKSE::RUNTIME_SSE_1_6_353);
+	REL::Module::reset();
+}
+
+TEST_CASE("IDDatabase/BinaryLoaderCache")
+{
+	check_cache_round_trip(
+		"Data/SKSE/Plugins/versionlib-1-6-353-0.bin",
+		L"Data\\SKSE\\Plugins\\versionlib-1-6-353-0.bin", REL::IDDatabase::Format::SSEv2, SKSE::RUNTIME_SSE_1_6_353,
+		REL::Module::Runtime::AE, L"SkyrimSE.exe");
+}
+
+TEST_CASE("IDDatabase/BinaryLoaderBenchmark", "[!benchmark]")
+{
+	REQUIRE(REL::Module::mock(SKSE::RUNTIME_SSE_1_6_353, REL::Module::Runtime::AE, L"SkyrimSE.exe", 0x1000));
+
+	BENCHMARK("std::ifstream")
+	{
+		return load_with_ifstream("Data/SKSE/Plugins/versionlib-1-6-353-0.bin").size();
+	};
+	BENCHMARK("IDDatabase::inject")
+	{
+		return REL::IDDatabase::inject(
+			L"Data\\SKSE\\Plugins\\versionlib-1-6-353-0.bin", REL::IDDatabase::Format::SSEv2, SKSE::RUNTIME_SSE_1_6_353);
+	};
+
+	REL::Module::reset();
+}
+#endif
+
+#ifdef ENABLE_SKYRIM_VR
+#	include <rapidcsv.h>
+
+namespace
+{
+	constexpr auto csv_path = L"Data\\SKSE\\Plugins\\version-1-4-15-0.csv";
+
+	// the rapidcsv based loader the CSV parser replaced, kept as the reference
+	std::vector<std::pair<std::uint64_t, std::uint64_t>> load_with_rapidcsv()
+	{
+		rapidcsv::Document in(SKSE::stl::utf16_to_utf8(csv_path).value_or(std::string{}));
+		const auto         rows = in.GetRowCount();
+
+		std::vector<std::pair<std::uint64_t, std::uint64_t>> entries;
+		entries.reserve(rows);
+		for (std::size_t row = 1; row < rows; ++row) {
+			const auto id = std::stoull(in.GetCell<std::string>(0, row));
+			const auto offset = std::stoull(in.GetCell<std::string>(1, row), nullptr, 16);
+			entries.emplace_back(id, offset);
+		}
+		return entries;
+	}
+}
+
+TEST_CASE("IDDatabase/CSVLoaderMatchesRapidCSV")
+{
+	const auto expected = load_with_rapidcsv();
+	REQUIRE(expected.size() == 12448);
+
+	REQUIRE(REL::Module::mock(SKSE::RUNTIME_VR_1_4_15, REL::Module::Runtime::VR, L"SkyrimVR.exe", 0x1000));
+	REQUIRE(REL::IDDatabase::inject(csv_path, REL::IDDatabase::Format::VR, SKSE::RUNTIME_VR_1_4_15));
+
+	const auto& db = REL::IDDatabase::get();
+	for (const auto& [id, offset] : expected) {
+		CHECK(db.id2offset(id) == offset);
+	}
+	CHECK(REL::IDDatabase::Offset2ID().size() == expected.size());
+	CHECK(db.IsVRAddressLibraryAtLeastVersion("0.31.0"));
+
+	REL::Module::reset();
+}
+
+TEST_CASE("IDDatabase/CSVLoaderCache")
+{
+	check_cache_round_trip(
+		"Data/SKSE/Plugins/version-1-4-15-0.csv", csv_path, REL::IDDatabase::Format::VR, SKSE::RUNTIME_VR_1_4_15,
+		REL::Module::Runtime::VR, L"SkyrimVR.exe");
+}
+
+TEST_CASE("IDDatabase/CSVLoaderBenchmark", "[!benchmark]")
+{
+	REQUIRE(REL::Module::mock(SKSE::RUNTIME_VR_1_4_15, REL::Module::Runtime::VR, L"SkyrimVR.exe", 0x1000));
+
+	BENCHMARK("rapidcsv")
+	{
+		return load_with_rapidcsv().size();
+	};
+	BENCHMARK("IDDatabase::inject")
+	{
+		return REL::IDDatabase::inject(csv_path, REL::IDDatabase::Format::VR, SKSE::RUNTIME_VR_1_4_15);
+	};
+
+	REL::Module::reset();
+}
+#endif
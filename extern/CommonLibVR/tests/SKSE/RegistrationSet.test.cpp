@@ -0,0 +1,121 @@
+#include "catch2/catch_all.hpp"
+
+#include "SKSE/SKSE.h"
+
+using SKSE::Impl::FlatHandleSet;
+
+TEST_CASE("FlatHandleSet/KeepsHandlesSortedAndUnique")
+{
+	FlatHandleSet set;
+	CHECK(set.empty());
+	CHECK(!set.snapshot());
+	CHECK(!set.erase(1));
+
+	CHECK(set.insert(30));
+	CHECK(set.insert(10));
+	CHECK(set.insert(20));
+	CHECK(!set.insert(20));
+	CHECK(set.size() == 3);
+	CHECK(set.contains(10));
+	CHECK(!set.contains(15));
+	CHECK(*set.snapshot() == FlatHandleSet::container_type{ 10, 20, 30 });
+
+	CHECK(set.erase(20));
+	CHECK(!set.erase(20));
+	CHECK(*set.snapshot() == FlatHandleSet::container_type{ 10, 30 });
+
+	set.assign({ 5, 3, 5, 1 });
+	CHECK(*set.snapshot() == FlatHandleSet::container_type{ 1, 3, 5 });
+
+	set.clear();
+	CHECK(set.empty());
+}
+
+TEST_CASE("FlatHandleSet/SnapshotsAreImmutable")
+{
+	FlatHandleSet set;
+	set.assign({ 1, 2, 3 });
+
+	const auto before = set.snapshot();
+	set.insert(4);
+	set.erase(1);
+	CHECK(*before == FlatHandleSet::container_type{ 1, 2, 3 });
+	CHECK(*set.snapshot() == FlatHandleSet::container_type{ 2, 3, 4 });
+
+	FlatHandleSet copy(set);
+	set.clear();
+	CHECK(copy.size() == 3);
+
+	FlatHandleSet moved(std::move(copy));
+	CHECK(moved.size() == 3);
+	CHECK(copy.empty());
+}
+
+TEST_CASE("FlatHandleSet/ConcurrentDispatch")
+{
+	FlatHandleSet        set;
+	std::recursive_mutex lock;
+	std::atomic_bool     done{ false };
+	std::atomic_size_t   malformed{ 0 };
+
+	// readers only ever see complete, sorted snapshots while a writer churns;
+	// Catch2 assertions are not thread-safe, so the reader only counts
+	// bad snapshots and the main thread checks the tally after the join
+	std::thread reader([&] {
+		while (!done.load()) {
+			if (const auto handles = set.snapshot()) {
+				if (!std::is_sorted(handles->begin(), handles->end()) ||
+					std::adjacent_find(handles->begin(), handles->end()) != handles->end()) {
+					++malformed;
+				}
+			}
+		}
+	});
+
+	for (RE::VMHandle handle = 0; handle < 2000; ++handle) {
+		std::lock_guard locker(lock);
+		set.insert(handle * 7919 % 2003);
+		if (handle % 3 == 0) {
+			set.erase(handle * 7 % 2003);
+		}
+	}
+	done.store(true);
+	reader.join();
+
+	CHECK(malformed.load() == 0);
+}
+
+TEST_CASE("FlatHandleSet/Benchmark", "[!benchmark]")
+{
+	for (const std::size_t registrants : { 10u, 100u, 1000u }) {
+		std::set<RE::VMHandle> tree;
+		std::recursive_mutex   lock;
+		FlatHandleSet          flat;
+		for (std::size_t i = 0; i < registrants; ++i) {
+			const auto handle = static_cast<RE::VMHandle>(0xFFFF00000000 | (i * 2654435761u % 0xFFFFFFFF));
+			tree.insert(handle);
+			flat.insert(handle);
+		}
+
+		const auto suffix = " (" + std::to_string(registrants) + " registrants)";
+		BENCHMARK("std::set dispatch" + suffix)
+		{
+			std::lock_guard locker(lock);
+			RE::VMHandle    sum = 0;
+			for (const auto handle : tree) {
+				sum += handle;
+			}
+			return sum;
+		};
+		BENCHMARK("FlatHandleSet dispatch" + suffix)
+		{
+			RE::VMHandle sum = 0;
+			if (const auto handles = flat.snapshot()) {
+				for (const auto handle : *handles) {
+					sum += handle;
+				}
+			}
+			return sum;
+		};
+	}
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <RE/Skyrim.h>
+#include <SKSE/SKSE.h>
+#include <cstdint>
+#include <vector>
+#include "ActorGrid.h"
+
+// ============================================
+// Actor broadphase
+// ============================================
+// Game-side owner of the ActorGrid. Re-indexes the high-process actors on
+// the first query of a frame (frames without a query cost nothing) and
+// answers "which actors are near this ray/capsule". PenetratingArrow uses
+// the ray query to pick the actors a tagged arrow may pass through.
+class ActorBroadphase
+{
+public:
+    static ActorBroadphase* GetSingleton();
+
+    // Rebuilds the grid if it is older than one frame
+    void Refresh();
+
+    // Live actors whose bounds touch the ray; returns the number of FormIDs written
+    std::size_t QueryRay(const RE::NiPoint3& origin, const RE::NiPoint3& direction, float length,
+                         RE::FormID* out, std::size_t maxOut);
+    std::size_t QueryCapsule(const RE::NiPoint3& a, const RE::NiPoint3& b, float radius,
+                             RE::FormID* out, std::size_t maxOut);
+
+private:
+    static constexpr float kCellSize = 512.0f;
+    static constexpr std::size_t kMaxResults = 64;
+
+    std::size_t ResolveHits(const std::uint32_t* ids, std::size_t count, RE::FormID* out, std::size_t maxOut) const;
+
+    ActorGrid grid{ kCellSize };
+    std::vector<ActorGrid::Entry> entries;
+    std::vector<RE::FormID> formIDs;  // grid id - 1 indexes this frame's actor
+    std::uint64_t lastRefreshFrame = ~std::uint64_t{ 0 };
+
+    ActorBroadphase() = default;
+    ~ActorBroadphase() = default;
+    ActorBroadphase(const ActorBroadphase&) = delete;
+    ActorBroadphase(ActorBroadphase&&) = delete;
+    ActorBroadphase& operator=(const ActorBroadphase&) = delete;
+    ActorBroadphase& operator=(ActorBroadphase&&) = delete;
+};
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+// ============================================
+// Uniform-grid broadphase
+// ============================================
+// Buckets actor bounding spheres into square XY cells so ray and capsule
+// queries only visit the cells the query touches. Entries are kept sorted by
+// cell; each update starts from the previous frame's order, so when few
+// actors change cells the re-sort is close to linear.
+class ActorGrid
+{
+public:
+    struct Entry {
+        std::uint32_t id = 0;  // caller-defined, e.g. a native actor handle
+        float x = 0.0f;
+        float y = 0.0f;
+        float z = 0.0f;
+        float radius = 0.0f;
+    };
+
+    explicit ActorGrid(float cellSize = 512.0f);
+
+    // Replaces the indexed actors with this frame's positions
+    void Update(std::span<const Entry> actors);
+    void Clear();
+
+    // Ids of actors whose sphere touches the capsule from a to b; returns the number written
+    std::size_t QueryCapsule(const float (&a)[3], const float (&b)[3], float radius, std::uint32_t* out, std::size_t maxOut) const;
+
+    // Ray of the given length (direction must be normalised); same as a capsule with radius 0
+    std::size_t QueryRay(const float (&origin)[3], const float (&direction)[3], float length, std::uint32_t* out, std::size_t maxOut) const;
+
+    // Linear reference used by tests and benchmarks
+    std::size_t QueryCapsuleBruteForce(const float (&a)[3], const float (&b)[3], float radius, std::uint32_t* out, std::size_t maxOut) const;
+
+    std::size_t Size() const { return entries.size(); }
+    std::size_t CellCount() const { return cellKeys.size(); }
+    std::size_t LastUpdateMoves() const { return lastUpdateMoves; }
+
+private:
+    struct Slot {
+        std::uint32_t cell;
+        std::uint32_t source;  // index into the caller's span from the last update
+        Entry entry;
+    };
+
+    std::uint32_t CellKey(float x, float y) const;
+    std::int32_t CellCoord(float value) const;
+    static bool Touches(const Entry& entry, const float (&a)[3], const float (&b)[3], float radius);
+
+    float cellSize;
+    float inverseCellSize;
+    float maxRadius = 0.0f;
+
+    std::vector<Slot> entries;             // sorted by cell
+    std::vector<std::uint32_t> cellKeys;   // unique cells, sorted
+    std::vector<std::uint32_t> cellStart;  // entries range of cellKeys[i] is [cellStart[i], cellStart[i + 1])
+    std::vector<Slot> scratch;
+    std::size_t lastUpdateMoves = 0;
+};
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <RE/Skyrim.h>
+#include <SKSE/SKSE.h>
+#include <cstdint>
+
+// ============================================
+// Per-frame archery context
+// ============================================
+// The player facts every technique checks before acting, fetched once per
+// frame (and again on equip or menu changes) instead of once per check.
+// Techniques read the snapshot through ArcheryContextService::Get().
+struct ArcheryContext {
+    RE::PlayerCharacter* player = nullptr;
+    RE::TESObjectWEAP* weapon = nullptr;  // right-hand weapon, if any
+    RE::TESAmmo* ammo = nullptr;
+    std::uint64_t frame = 0;              // GameClock frame the snapshot was built in
+
+    bool inKillMove = false;
+    bool isDead = false;
+    bool gamePaused = false;
+    bool hasBow = false;                  // weapon is a bow (crossbows excluded)
+
+    // Player exists, is alive, not in a kill move and the game is running
+    bool CanAct() const { return player && !inKillMove && !isDead && !gamePaused; }
+    bool CanShoot() const { return CanAct() && hasBow; }
+};
+
+class ArcheryContextService :
+    public RE::BSTEventSink<RE::TESEquipEvent>,
+    public RE::BSTEventSink<RE::MenuOpenCloseEvent>
+{
+public:
+    static ArcheryContextService* GetSingleton();
+
+    // Shorthand for GetSingleton()->Current()
+    static const ArcheryContext& Get();
+
+    void Register();
+    void Rebuild();
+    const ArcheryContext& Current();
+
+    RE::BSEventNotifyControl ProcessEvent(const RE::TESEquipEvent* a_event,
+                                          RE::BSTEventSource<RE::TESEquipEvent>* a_eventSource) override;
+    RE::BSEventNotifyControl ProcessEvent(const RE::MenuOpenCloseEvent* a_event,
+                                          RE::BSTEventSource<RE::MenuOpenCloseEvent>* a_eventSource) override;
+
+    // Game calls one rebuild makes (singletons, state checks, equipment lookups)
+    static constexpr std::uint32_t kGameCallsPerBuild = 8;
+
+    // Game calls avoided so far this frame: every read would otherwise have made a full rebuild's worth
+    std::uint32_t GetSavedCallsThisFrame() const;
+
+private:
+    void OnFrameStart(std::uint64_t frame);
+
+    ArcheryContext context{};
+    std::uint64_t countersFrame = 0;
+    std::uint32_t readsThisFrame = 0;
+    std::uint32_t buildsThisFrame = 0;
+    std::uint64_t totalSavedCalls = 0;
+
+    ArcheryContextService() = default;
+    ~ArcheryContextService() = default;
+    ArcheryContextService(const ArcheryContextService&) = delete;
+    ArcheryContextService(ArcheryContextService&&) = delete;
+    ArcheryContextService& operator=(const ArcheryContextService&) = delete;
+    ArcheryContextService& operator=(ArcheryContextService&&) = delete;
+};
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstddef>
+
+// ============================================
+// Ballistic convergence solver
+// ============================================
+// Solves the launch angles that make a projectile fired at a fixed speed pass
+// through a target point under constant gravity. Angles follow the game's
+// ProjectileRot convention: pitch (x) is positive when aiming down, yaw (z)
+// is measured clockwise from +Y.
+//
+// Inputs are structure-of-arrays deltas (target - origin) so that every
+// kernel can process N arrows at once. Targets out of range are clamped to
+// the maximum-range elevation and counted in the return value.
+namespace Ballistics {
+    // Havok works in metres, the game in units (1 unit = 0.0142875 m)
+    constexpr float kHavokGravity = 9.81f;
+    constexpr float kHavokWorldScale = 0.0142875f;
+    constexpr float kGravityUnits = kHavokGravity / kHavokWorldScale;
+
+    struct ConvergenceBatch {
+        const float* dx = nullptr;  // target - origin, game units
+        const float* dy = nullptr;
+        const float* dz = nullptr;
+        float* pitch = nullptr;     // out, radians
+        float* yaw = nullptr;       // out, radians
+        std::size_t count = 0;
+    };
+
+    // Reference implementation, one arrow at a time
+    std::size_t SolveScalar(const ConvergenceBatch& batch, float speed, float gravity);
+
+    // 4-wide SSE kernel with scalar tail
+    std::size_t SolveSSE(const ConvergenceBatch& batch, float speed, float gravity);
+
+    // 8-wide AVX kernel with SSE/scalar tail; only available when built with AVX enabled
+    std::size_t SolveAVX(const ConvergenceBatch& batch, float speed, float gravity);
+    bool HasAVX();
+
+    // Dispatches to the widest kernel compiled in
+    std::size_t Solve(const ConvergenceBatch& batch, float speed, float gravity);
+}
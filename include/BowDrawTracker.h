@@ -0,0 +1,62 @@
+#pragma once
+
+#include <RE/Skyrim.h>
+#include <SKSE/SKSE.h>
+#include <chrono>
+#include "DrawDetector.h"
+#include "GameClock.h"
+
+// ============================================
+// VR bow draw tracker
+// ============================================
+// Samples the VR bow state and hand nodes once per frame (see FrameHook)
+// and reports draw start/stop to PenetratingArrowHandler as they
+// happen, replacing the bowDraw animation event heuristics. Outside VR the
+// node data is unavailable and the tracker stays inactive.
+//
+// Each frame's draw strength goes into a fixed history window that is also
+// logged when a draw ends, for tuning fFullDrawDistance. While an arrow is
+// knocked but not drawn the window holds those idle frames instead; the
+// newest one at the draw-start edge gives the rest pose the pull is
+// measured from.
+class BowDrawTracker
+{
+public:
+    static BowDrawTracker* GetSingleton();
+
+    // Called once per frame with the frame's game delta
+    void Sample(RE::PlayerCharacter* player, float delta);
+
+    // True while per-frame VR samples are the source of draw start/stop
+    bool IsActive() const { return active; }
+    bool IsDrawing() const { return detector.IsDrawing(); }
+    const DrawDetector::Sample& GetLastSample() const { return lastSample; }
+    GameClock::RealTime GetDrawStartTime() const { return drawStartTime; }
+
+    // Normalised pull of the current frame (0-1) and the frame time it covers
+    float GetDrawStrength() const { return drawStrength; }
+    float GetLastDelta() const { return lastDelta; }
+
+    static constexpr std::size_t kHistoryFrames = 64;
+    using DrawHistory = DrawDetector::History<kHistoryFrames>;
+    const DrawHistory& GetHistory() const { return history; }
+
+private:
+    void LogHistory() const;
+
+    DrawDetector::Detector detector;
+    DrawDetector::Sample lastSample{};
+    DrawHistory history;
+    float restDistance = 0.0f;  // hand separation on the last knocked frame before the draw
+    float drawStrength = 0.0f;
+    float lastDelta = 0.0f;
+    GameClock::RealTime drawStartTime{};
+    bool active = false;
+
+    BowDrawTracker() = default;
+    ~BowDrawTracker() = default;
+    BowDrawTracker(const BowDrawTracker&) = delete;
+    BowDrawTracker(BowDrawTracker&&) = delete;
+    BowDrawTracker& operator=(const BowDrawTracker&) = delete;
+    BowDrawTracker& operator=(BowDrawTracker&&) = delete;
+};
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <RE/Skyrim.h>
+#include <SKSE/SKSE.h>
+
+// ============================================
+// Console commands
+// ============================================
+// Takes over an unused debug console command and renames it, the usual way
+// for an SKSE plugin to add one: "ArcheryStats" prints the latency
+// histograms and counters from Metrics, and exports the profiling zones when
+// tracing is on.
+namespace ConsoleCommands {
+    void Install();
+
+    // Writes the recorded Trace zones to ArcheryTechniques.trace.json in the SKSE log folder
+    void ExportTrace();
+}
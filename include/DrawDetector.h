@@ -0,0 +1,128 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// ============================================
+// Bow draw detection
+// ============================================
+// Turns per-frame samples of the VR bow into draw start/stop edges. The
+// engine's draw amount is noisy around zero while the hand settles on the
+// string, so the start and stop thresholds are separated (hysteresis).
+//
+// Draw strength is the hand separation beyond the knocked-arrow rest pose,
+// normalised by the configured full-draw distance. It weights the charge
+// integrator so a half-drawn bow charges at half speed.
+namespace DrawDetector {
+    struct Sample {
+        bool arrowKnocked = false;  // VR_NODE_DATA::bowState == kArrowKnocked
+        float drawAmount = 0.0f;    // VR_NODE_DATA::currentBowDrawAmount, 0-1
+        float handDistance = 0.0f;  // game units between the hand nodes
+    };
+
+    enum class Edge : std::uint8_t {
+        None,
+        Started,
+        Stopped
+    };
+
+    constexpr float kStartThreshold = 0.10f;
+    constexpr float kStopThreshold = 0.03f;
+
+    class Detector
+    {
+    public:
+        // Feed one sample per frame; returns the transition it caused, if any
+        Edge Step(const Sample& sample);
+        void Reset() { drawing = false; }
+
+        bool IsDrawing() const { return drawing; }
+
+    private:
+        bool drawing = false;
+    };
+
+    // 0 at the rest pose, 1 at or beyond a full draw
+    float ComputeStrength(float handDistance, float restDistance, float fullDrawDistance);
+
+    struct HistoryEntry {
+        float strength = 0.0f;
+        float drawAmount = 0.0f;
+        float handDistance = 0.0f;
+        float delta = 0.0f;  // seconds covered by this frame
+    };
+
+    // Fixed window of the most recent frames. Push and Mean are O(1) and never
+    // allocate; the full window is kept for tuning telemetry.
+    template <std::size_t N>
+    class History
+    {
+    public:
+        static_assert(N > 0);
+
+        void Push(const HistoryEntry& entry)
+        {
+            if (count == N) {
+                strengthSum -= entries[head].strength;
+            } else {
+                ++count;
+            }
+            entries[head] = entry;
+            strengthSum += entry.strength;
+            head = (head + 1) % N;
+        }
+
+        void Clear()
+        {
+            head = 0;
+            count = 0;
+            strengthSum = 0.0;
+        }
+
+        std::size_t Size() const { return count; }
+        static constexpr std::size_t Capacity() { return N; }
+
+        // Most recent entry, or nullptr when empty
+        const HistoryEntry* Newest() const { return count ? &entries[(head + N - 1) % N] : nullptr; }
+
+        float MeanStrength() const { return count ? static_cast<float>(strengthSum / static_cast<double>(count)) : 0.0f; }
+
+        float PeakStrength() const
+        {
+            float peak = 0.0f;
+            ForEach([&](const HistoryEntry& entry) { peak = entry.strength > peak ? entry.strength : peak; });
+            return peak;
+        }
+
+        // Oldest to newest
+        template <class F>
+        void ForEach(F&& callback) const
+        {
+            std::size_t first = (head + N - count) % N;
+            for (std::size_t i = 0; i < count; ++i) {
+                callback(entries[(first + i) % N]);
+            }
+        }
+
+    private:
+        std::array<HistoryEntry, N> entries{};
+        std::size_t head = 0;
+        std::size_t count = 0;
+        double strengthSum = 0.0;
+    };
+
+    // Charge progress where a full-strength draw reaches 1 after chargeTime seconds
+    class ChargeIntegrator
+    {
+    public:
+        float Advance(float strength, float delta, float chargeTime);
+        void Reset() { progress = 0.0f; }
+
+        float Progress() const { return progress; }
+        bool IsComplete() const { return progress >= 1.0f; }
+
+    private:
+        float progress = 0.0f;
+    };
+}
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <string_view>
+#include <vector>
+#include "TechniqueConfig.h"
+
+// ============================================
+// Event log
+// ============================================
+// Compact binary capture of what reaches the technique logic in a session:
+// frame ticks with the player facts the logic reads, activation key presses,
+// animation tags per receiving handler, VR draw edges, and a state checkpoint
+// at the end of every frame whose states changed. The header carries the
+// technique settings so a replay runs against the same config.
+//
+// Layout: Header, then fixed-size Records until end of file. A truncated
+// trailing record (the game closed mid-write) is ignored.
+namespace EventLog {
+    constexpr std::uint32_t kMagic = 'A' | ('R' << 8) | ('C' << 16) | ('L' << 24);
+    constexpr std::uint16_t kVersion = 1;
+
+    enum class Type : std::uint8_t {
+        Frame,      // value = game delta, flags = Fact bits
+        Update,     // penetrating handler ran its update (frame hook or input event)
+        KeyPress,   // multishot key passed the debounce; data = key code
+        AnimTag,    // data = Tag, flags = receiving Game::Technique, value = ammo count on arrow release
+        DrawStart,  // VR tracker edges
+        DrawStop,
+        DrawFrame,  // value = draw strength, applied over the current frame's delta
+        State       // data = multishot state | penetrating state << 8, after the frame's updates
+    };
+
+    enum class Tag : std::uint32_t {
+        Other,
+        BowDraw,      // bowDraw, bowDrawStart
+        BowDrawStop,  // bowDrawStop, bowRelease, bowUnDraw, weaponSwing, weaponLeftSwing
+        ArrowRelease  // arrowRelease
+    };
+
+    // Player facts sampled into each Frame record
+    enum Fact : std::uint16_t {
+        kPresent = 1 << 0,
+        kIncapacitated = 1 << 1,
+        kPaused = 1 << 2,
+        kHasBow = 1 << 3,
+        kHasAmmo = 1 << 4,
+        kMultishotPerk = 1 << 5,
+        kPenetratingPerk = 1 << 6,
+        kDrawTracked = 1 << 7,
+        kDrawing = 1 << 8
+    };
+
+    struct Header {
+        std::uint32_t magic = kMagic;
+        std::uint16_t version = kVersion;
+        std::uint16_t recordSize = 0;
+        MultishotConfig multishot;
+        PenetratingArrowConfig penetratingArrow;
+        bool enablePerks = false;
+    };
+
+    struct Record {
+        Type type = Type::Frame;
+        std::uint8_t pad = 0;
+        std::uint16_t flags = 0;
+        std::uint32_t data = 0;
+        float value = 0.0f;
+    };
+    static_assert(sizeof(Record) == 12);
+
+    // State record payload
+    constexpr std::uint32_t PackState(std::uint8_t multishot, std::uint8_t penetrating)
+    {
+        return static_cast<std::uint32_t>(multishot) | (static_cast<std::uint32_t>(penetrating) << 8);
+    }
+
+    // Tag group of an animation event name
+    Tag ClassifyTag(std::string_view tag);
+
+    // Buffered file writer; records are flushed when the buffer fills, on Flush() and on Close()
+    class Writer
+    {
+    public:
+        Writer() = default;
+        ~Writer();
+        Writer(const Writer&) = delete;
+        Writer& operator=(const Writer&) = delete;
+
+        bool Open(const std::filesystem::path& path, const Header& header);
+        void Append(const Record& record);
+        void Flush();
+        void Close();
+
+        bool IsOpen() const { return file != nullptr; }
+        std::size_t Count() const { return count; }
+
+    private:
+        static constexpr std::size_t kBufferRecords = 4096;
+
+        std::FILE* file = nullptr;
+        std::vector<Record> buffer;
+        std::size_t count = 0;
+    };
+
+    // Reads a whole log; false if the file is missing or not a log of this version
+    bool Read(const std::filesystem::path& path, Header& header, std::vector<Record>& records);
+}
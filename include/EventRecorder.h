@@ -0,0 +1,54 @@
+#pragma once
+
+#include <RE/Skyrim.h>
+#include <SKSE/SKSE.h>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include "EventLog.h"
+#include "GameFacade.h"
+
+// ============================================
+// Event recorder
+// ============================================
+// Writes the session's technique events to <SKSE logs>/ArcheryTechniques.events
+// when bRecordEvents is set, for the headless replay tool. Every Record* call
+// is a single relaxed load when recording is off. The writer itself is only
+// touched under the lock; handlers on other threads read the atomic flag.
+class EventRecorder
+{
+public:
+    static EventRecorder* GetSingleton();
+
+    // Opens the log if recording is enabled in the config
+    void Start();
+    bool IsRecording() const { return recording.load(std::memory_order_relaxed); }
+
+    void RecordFrame(float gameDelta);
+    void RecordUpdate();
+    void RecordKeyPress(std::uint32_t keyCode);
+    void RecordAnimTag(Game::Technique receiver, EventLog::Tag tag);
+    void RecordDraw(EventLog::Type type, float strength = 0.0f);
+
+    // End of frame: writes the technique states if they changed
+    void Checkpoint();
+
+private:
+    void Append(const EventLog::Record& record);
+
+    // Buffered records reach the disk at least this often
+    static constexpr std::uint64_t kFlushFrames = 900;
+
+    EventLog::Writer writer;
+    std::uint32_t lastState = ~0u;
+    std::uint64_t frames = 0;
+    std::mutex lock;
+    std::atomic<bool> recording{ false };  // writer.IsOpen(), published under the lock
+
+    EventRecorder() = default;
+    ~EventRecorder() = default;
+    EventRecorder(const EventRecorder&) = delete;
+    EventRecorder(EventRecorder&&) = delete;
+    EventRecorder& operator=(const EventRecorder&) = delete;
+    EventRecorder& operator=(EventRecorder&&) = delete;
+};
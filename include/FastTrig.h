@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>
+#include <numbers>
+
+// ============================================
+// Fast approximate trigonometry
+// ============================================
+// Single-precision sin/cos/atan/atan2 for the projectile angle math. Each
+// function is a range reduction followed by a short minimax polynomial
+// (Cody-Waite + Cephes for sin/cos, Cephes atanf for atan), written without
+// table lookups or branches so the same arithmetic runs one lane at a time or
+// across 4 (SSE) / 8 (AVX) lanes. The scalar and span forms agree to within
+// rounding; both stay within the error bounds below of the libm result.
+namespace FastTrig {
+    constexpr float kPi = std::numbers::pi_v<float>;
+    constexpr float kHalfPi = kPi / 2.0f;
+
+    // Maximum absolute error against double-precision libm, in radians / unit
+    // output. Checked by the accuracy sweep in FastTrig.test.cpp.
+    constexpr float kSinCosMaxError = 1.0e-7f;   // for |x| <= kSinCosRange
+    constexpr float kAtanMaxError = 2.5e-7f;     // atan and atan2, any finite input
+    constexpr float kSinCosRange = 8192.0f;
+
+    constexpr float ToRadians(float degrees) { return degrees * (kPi / 180.0f); }
+    constexpr float ToDegrees(float radians) { return radians * (180.0f / kPi); }
+
+    float Sin(float x);
+    float Cos(float x);
+    void SinCos(float x, float& sin, float& cos);
+    float Atan(float x);
+
+    // Same conventions as std::atan2, including the signed-zero cases
+    float Atan2(float y, float x);
+
+    // Span forms. Outputs may alias the matching input exactly.
+    void SinCos(const float* x, float* sin, float* cos, std::size_t count);
+    void Atan(const float* x, float* out, std::size_t count);
+    void Atan2(const float* y, const float* x, float* out, std::size_t count);
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <RE/Skyrim.h>
+#include <SKSE/SKSE.h>
+
+// ============================================
+// Per-frame update
+// ============================================
+// Hooks PlayerCharacter::Update, the one place the plugin runs every frame:
+// drains the TaskQueue, ticks the GameClock and rebuilds the ArcheryContext,
+// moves the technique animation sinks onto a rebuilt player graph, then lets
+// the techniques sample and update, reclaims the penetration slots of
+// destroyed arrows, and finally posts the frame's due notifications to the UI
+// thread.
+namespace FrameHook {
+    void Install();
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+// ============================================
+// Per-frame game clock
+// ============================================
+// Sampled once per frame from the player's update so every handler sees the
+// same timestamps within a frame and nobody reads the system clock on their
+// own. Technique timers run on GameTime(), which stops while the game is
+// paused; RealNow() is the cached wall clock for input debouncing and logs.
+class GameClock
+{
+public:
+    using RealTime = std::chrono::steady_clock::time_point;
+
+    static GameClock* GetSingleton();
+
+    // Advances to the next frame; gameDelta is ignored while paused
+    void Tick(RealTime now, float gameDelta, bool paused);
+
+    std::uint64_t FrameNumber() const { return frameNumber; }
+    float RealDelta() const { return realDelta; }
+    float GameDelta() const { return gameDelta; }
+    bool IsPaused() const { return paused; }
+
+    // Seconds of unpaused play since the clock started; never decreases
+    double GameTime() const { return gameTime; }
+    RealTime RealNow() const { return realNow; }
+
+    // Seconds of play since a GameTime() timestamp
+    float Since(double gameTimestamp) const { return static_cast<float>(gameTime - gameTimestamp); }
+
+private:
+    // Frame deltas beyond this (loading screens, debugger breaks) are clamped
+    static constexpr float kMaxDelta = 0.25f;
+
+    std::uint64_t frameNumber = 0;
+    float realDelta = 0.0f;
+    float gameDelta = 0.0f;
+    bool paused = false;
+    double gameTime = 0.0;
+    RealTime realNow{};
+};
+
+// Lets an update through once per GameClock frame however many events call it
+class FrameGate
+{
+public:
+    // True the first time it sees a frame number
+    bool Enter(std::uint64_t frame)
+    {
+        if (frame == lastFrame) {
+            return false;
+        }
+        lastFrame = frame;
+        return true;
+    }
+
+private:
+    std::uint64_t lastFrame = ~0ull;
+};
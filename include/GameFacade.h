@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstdint>
+
+// ============================================
+// Game facade
+// ============================================
+// The handful of game facts and actions the technique state machines use.
+// The plugin implements it on top of ArcheryContext, GameClock and the
+// projectile code; tests implement it with plain fields so the same logic
+// runs headless, off the game thread and off Windows.
+namespace Game {
+    enum class Technique {
+        Multishot,
+        PenetratingArrow
+    };
+
+    // State changes worth a log line or an on-screen message; value carries
+    // the seconds or arrow count the message quotes
+    enum class Event {
+        MultishotReady,
+        MultishotAlreadyReady,
+        MultishotOnCooldown,
+        MultishotTriggered,
+        MultishotInsufficientAmmo,
+        MultishotExpired,
+        MultishotCooldownFinished,
+        MultishotRestored,
+        PenetratingCharging,
+        PenetratingCharged,
+        PenetratingFired,
+        PenetratingDrawLost,
+        PenetratingBlockedByMultishot,
+        PenetratingCooldownFinished,
+        PenetratingRestored
+    };
+
+    struct Shooter {
+        bool present = false;       // the player exists
+        bool incapacitated = false; // dead or in a kill move
+        bool paused = false;        // a pausing menu is open
+        bool hasBow = false;
+        bool hasAmmo = false;       // weapon and ammo both equipped
+
+        bool CanShoot() const { return present && !incapacitated && !paused && hasBow; }
+    };
+
+    class Facade
+    {
+    public:
+        virtual ~Facade() = default;
+
+        // Seconds of unpaused play; technique timers are stamps on this clock
+        virtual double GameTime() const = 0;
+        virtual Shooter GetShooter() const = 0;
+        virtual std::uint32_t PlayerID() const = 0;
+
+        // True when perks are disabled in the config or the player has the technique's perk
+        virtual bool MeetsPerkRequirement(Technique technique) const = 0;
+        virtual int AmmoCount() const = 0;
+
+        // VR draw tracking: when tracked, draw start/stop and strength come from the bow itself
+        virtual bool IsDrawTracked() const = 0;
+        virtual bool IsDrawing() const = 0;
+
+        // Deferred launches, run once the vanilla arrow is out
+        virtual void LaunchVolley(int arrowCount, int additionalArrows) = 0;
+        virtual void LaunchPenetratingArrow() = 0;
+
+        virtual void Report(Event event, float value = 0.0f) = 0;
+    };
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstdint>
+
+// ============================================
+// Game query kernels
+// ============================================
+// The per-call filters the handlers run over game data: the activation key in
+// an input batch, the player's newest arrow in the projectile arrays and the
+// ammo count in the inventory changes. They are templates over the CommonLib
+// types so the headless tests and benchmarks run the plugin's own code against
+// stand-ins with the same member names.
+namespace GameQueries {
+    // First keyboard press of keyCode in an input event chain (down this
+    // frame, not held), or nullptr. kButton and kKeyboard are the game's
+    // button event type and keyboard device.
+    template <auto kButton, auto kKeyboard, class Event>
+    auto FindKeyPress(Event* chain, std::uint32_t keyCode) -> decltype(chain->AsButtonEvent())
+    {
+        for (auto* event = chain; event; event = event->next) {
+            if (event->GetEventType() != kButton) {
+                continue;
+            }
+            auto* button = event->AsButtonEvent();
+            if (button && button->GetDevice() == kKeyboard && button->GetIDCode() == keyCode && button->IsDown()) {
+                return button;
+            }
+        }
+        return nullptr;
+    }
+
+    // Whether a projectile is a newer arrow of the player's than the newest found
+    // so far. Age and shooter are plain fields, and the shooter handle compares
+    // by value without resolving it, so the virtual missile check runs last.
+    template <class Handle, class IsMissile>
+    bool IsNewerPlayerArrow(float livingTime, float newestLivingTime, const Handle& shooter, const Handle& player, IsMissile&& isMissile)
+    {
+        return livingTime < newestLivingTime && shooter == player && isMissile();
+    }
+
+    // Count of one item as GetInventory totals it, without building its map:
+    // the item's first change entry adds its delta, and the container's base
+    // count (baseCount(), only called when needed) is added unless that entry
+    // is leveled.
+    template <class Entries, class Object, class BaseCount>
+    int CountItem(const Entries& entries, const Object* object, BaseCount&& baseCount)
+    {
+        int count = 0;
+        bool leveled = false;
+        for (auto* entry : entries) {
+            if (entry && entry->object == object) {
+                count = entry->countDelta;
+                leveled = entry->IsLeveled();
+                break;
+            }
+        }
+        if (!leveled) {
+            count += baseCount();
+        }
+        return count;
+    }
+}
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// ============================================
+// Latency histograms and counters
+// ============================================
+// Always-on instrumentation for the technique hot paths. Recording is a few
+// relaxed atomic adds into fixed arrays, safe from any thread and cheap enough
+// to leave in release builds; nothing is formatted until the console command
+// or the periodic log line asks for it.
+class LatencyHistogram
+{
+public:
+    // Log-linear buckets as in HdrHistogram: 8 linear steps per power of two,
+    // so a reported value is within 12.5% of the recorded one
+    static constexpr int kSubBucketBits = 3;
+    static constexpr int kSubBuckets = 1 << kSubBucketBits;
+    static constexpr int kMaxExponent = 40;  // 2^41 ns is about 36 minutes; longer values land in the last bucket
+    static constexpr int kBucketCount = (kMaxExponent - kSubBucketBits + 2) * kSubBuckets;
+
+    struct Summary {
+        std::uint64_t count = 0;
+        std::uint64_t mean = 0;
+        std::uint64_t p50 = 0;
+        std::uint64_t p90 = 0;
+        std::uint64_t p99 = 0;
+        std::uint64_t max = 0;
+    };
+
+    static int BucketIndex(std::uint64_t value);
+    // Largest value that falls in the bucket
+    static std::uint64_t BucketUpperBound(int index);
+
+    void Record(std::uint64_t value);
+    void Reset();
+
+    std::uint64_t Count() const { return count.load(std::memory_order_relaxed); }
+    // Value at quantile q (0-1); concurrent records may make it slightly stale
+    std::uint64_t Percentile(double q) const;
+    Summary Summarize() const;
+
+private:
+    std::array<std::atomic<std::uint32_t>, kBucketCount> buckets{};
+    std::atomic<std::uint64_t> count{ 0 };
+    std::atomic<std::uint64_t> sum{ 0 };
+    std::atomic<std::uint64_t> max{ 0 };
+};
+
+class Metrics
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    // Timed stages, in nanoseconds
+    enum class Stage : std::uint8_t {
+        ReleaseToLaunch,  // arrowRelease event to extra arrows launched
+        PenetratingFind,  // search of the projectile arrays for the player's arrow
+        Frame,            // plugin work in one PlayerCharacter::Update
+        TaskDrain,        // running one frame's queued tasks
+        kCount
+    };
+
+    enum class Counter : std::uint8_t {
+        AnimEvents,               // animation graph events seen by the handlers
+        InputEvents,              // input event batches seen by the handlers
+        Volleys,                  // multishot volleys launched
+        ArrowsLaunched,           // extra arrows that left the bow
+        LaunchFailures,           // extra arrows LaunchArrow refused
+        PenetratingShots,         // arrows turned into penetrating shots
+        PenetratingMisses,        // penetrating shots whose arrow was not found
+        TasksDropped,             // launches lost because the task interface was unavailable
+        TasksQueued,              // tasks pushed to the TaskQueue
+        TasksBoxed,               // queued tasks whose capture was too big for a slot and went to the heap
+        NotificationsShown,       // on-screen messages posted to the HUD
+        NotificationsSuppressed,  // on-screen messages coalesced or throttled away
+        kCount
+    };
+
+    // Times the enclosing scope into a stage
+    class ScopedTimer
+    {
+    public:
+        explicit ScopedTimer(Stage stage) :
+            stage(stage), start(Clock::now())
+        {
+        }
+        ~ScopedTimer() { Metrics::GetSingleton()->RecordSince(stage, start); }
+
+        ScopedTimer(const ScopedTimer&) = delete;
+        ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+    private:
+        Stage stage;
+        Clock::time_point start;
+    };
+
+    static Metrics* GetSingleton();
+
+    static const char* ToString(Stage stage);
+    static const char* ToString(Counter counter);
+
+    void Record(Stage stage, std::uint64_t nanoseconds) { histograms[static_cast<std::size_t>(stage)].Record(nanoseconds); }
+    void RecordSince(Stage stage, Clock::time_point start);
+    void Increment(Counter counter, std::uint64_t amount = 1)
+    {
+        counters[static_cast<std::size_t>(counter)].fetch_add(amount, std::memory_order_relaxed);
+    }
+
+    const LatencyHistogram& Histogram(Stage stage) const { return histograms[static_cast<std::size_t>(stage)]; }
+    std::uint64_t Get(Counter counter) const { return counters[static_cast<std::size_t>(counter)].load(std::memory_order_relaxed); }
+    void Reset();
+
+    // Everything on one line, for the periodic log entry
+    std::string FormatLine() const;
+    // One line per stage and one for the counters, for the console
+    std::vector<std::string> FormatReport() const;
+
+private:
+    std::array<LatencyHistogram, static_cast<std::size_t>(Stage::kCount)> histograms;
+    std::array<std::atomic<std::uint64_t>, static_cast<std::size_t>(Counter::kCount)> counters{};
+
+    Metrics() = default;
+    ~Metrics() = default;
+    Metrics(const Metrics&) = delete;
+    Metrics(Metrics&&) = delete;
+    Metrics& operator=(const Metrics&) = delete;
+    Metrics& operator=(Metrics&&) = delete;
+};
@@ -3,12 +3,9 @@
 #include <RE/Skyrim.h>
 #include <SKSE/SKSE.h>
 #include <chrono>
-
-enum class MultishotState {
-    Inactive,   // Normal state, multishot not available
-    Ready,      // Ready window active, next shot will be multishot
-    Cooldown    // Cooldown period, cannot activate ready state
-};
+#include "PlayerGraphSink.h"
+#include "TechniqueLogic.h"
+#include "TechniqueRecord.h"
 
 class MultishotHandler : 
     public RE::BSTEventSink<RE::InputEvent*>,
@@ -39,17 +36,26 @@ public:
     // Utility methods
     bool CanActivateReadyState();
     bool IsValidBow(RE::TESObjectWEAP* weapon);
-    bool HasSufficientAmmo(int requiredCount);
     void ConsumeAmmo(int count);
-    void RegisterAnimationEventHandler();
+    
+    // Co-save: the player's ready window or cooldown as seconds of play left
+    void Save(TechniqueRecord::Record& record) const;
+    void Load(const TechniqueRecord::Entry& entry);
+    void Revert();
+
+    const MultishotLogic& GetLogic() const { return logic; }
+
+    // Called once per frame by FrameHook to follow the player's animation graph
+    void RefreshAnimationSink() { animationSink.Refresh(); }
     
 private:
-    MultishotState currentState = MultishotState::Inactive;
-    std::chrono::steady_clock::time_point readyStateStartTime{};
-    std::chrono::steady_clock::time_point cooldownStartTime{};
+    MultishotLogic logic;
     std::chrono::steady_clock::time_point lastActivationTime{};
     
-    MultishotHandler() = default;
+    // Registration with the player's animation graph, following it across rebuilds
+    PlayerGraphSink animationSink{ this, "Multishot" };
+
+    MultishotHandler();
     ~MultishotHandler() = default;
     MultishotHandler(const MultishotHandler&) = delete;
     MultishotHandler(MultishotHandler&&) = delete;
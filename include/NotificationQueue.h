@@ -0,0 +1,63 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string_view>
+#include "GameClock.h"
+
+// ============================================
+// On-screen message throttling
+// ============================================
+// Sits between the technique reports and RE::DebugNotification so key mashing
+// cannot flood the HUD queue. Each channel (one per technique) holds at most
+// one pending message in a fixed buffer:
+//   - a newer message replaces the pending one, so a burst shows only its
+//     latest state;
+//   - a message identical to the one last shown is dropped until the
+//     interval is up;
+//   - a channel shows at most one message per interval, and a message held
+//     back by the interval is shown as soon as it is up.
+// FrameHook takes the due messages once per frame and posts them to the UI
+// thread in a single task. Post may be called from any thread.
+class NotificationQueue
+{
+public:
+    enum class Channel : std::uint8_t {
+        Multishot,
+        PenetratingArrow,
+        kCount
+    };
+
+    static constexpr std::size_t kChannelCount = static_cast<std::size_t>(Channel::kCount);
+    static constexpr std::size_t kMaxLength = 63;  // longer text is truncated
+
+    using Text = std::array<char, kMaxLength + 1>;  // null-terminated
+
+    // Messages due in one frame, at most one per channel, in channel order
+    struct Batch {
+        std::array<Text, kChannelCount> messages{};
+        std::size_t count = 0;
+    };
+
+    static NotificationQueue* GetSingleton();
+
+    void Post(Channel channel, std::string_view text);
+
+    // Removes and returns the messages due at now; interval is in seconds,
+    // 0 shows every pending message immediately
+    Batch TakeDue(GameClock::RealTime now, float interval);
+
+private:
+    struct ChannelState {
+        Text pending{};
+        Text shown{};
+        GameClock::RealTime shownAt{};
+        bool hasPending = false;
+        bool hasShown = false;
+    };
+
+    std::mutex lock;
+    std::array<ChannelState, kChannelCount> channels{};
+};
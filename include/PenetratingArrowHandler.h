@@ -3,14 +3,10 @@
 #include <RE/Skyrim.h>
 #include <SKSE/SKSE.h>
 #include <chrono>
-
-enum class PenetratingArrowState {
-    Inactive,   // Normal state, not tracking bow draw
-    Drawing,    // Bow is being drawn
-    Charging,   // Bow is fully drawn, charging for penetrating shot
-    Charged,    // Arrow is charged and ready for penetrating shot
-    Cooldown    // Cooldown period after firing penetrating arrow
-};
+#include "GameClock.h"
+#include "PlayerGraphSink.h"
+#include "TechniqueLogic.h"
+#include "TechniqueRecord.h"
 
 class PenetratingArrowHandler : 
     public RE::BSTEventSink<RE::BSAnimationGraphEvent>,
@@ -29,6 +25,7 @@ public:
     void Update(); // Called periodically to check bow state
     void OnBowDrawStart(); // Called when bow draw starts
     void OnBowDrawStop(); // Called when bow draw stops
+    void OnDrawFrame(float drawStrength, float delta); // VR: called once per frame while the string is pulled
     void OnArrowRelease(); // Called when arrow is released
     void StartCharging(); // Begin charging process
     void ResetState(); // Reset to inactive state
@@ -44,20 +41,24 @@ public:
     // Utility methods
     bool CanStartCharging() const;
     bool IsValidBow(RE::TESObjectWEAP* weapon) const;
-    void RegisterAnimationEventHandler();
     void LaunchPenetratingArrow(RE::PlayerCharacter* player, RE::TESObjectWEAP* weapon, RE::TESAmmo* ammo);
     
-private:
-    PenetratingArrowState currentState = PenetratingArrowState::Inactive;
-    std::chrono::steady_clock::time_point chargingStartTime{};
-    std::chrono::steady_clock::time_point cooldownStartTime{};
-    std::chrono::steady_clock::time_point lastBowDrawTime{};
+    // Co-save: only the cooldown survives a load; a charge needs the bow held
+    void Save(TechniqueRecord::Record& record) const;
+    void Load(const TechniqueRecord::Entry& entry);
+    void Revert();
+
+    // Called once per frame by FrameHook to follow the player's animation graph
+    void RefreshAnimationSink() { animationSink.Refresh(); }
     
-    // Internal methods
-    void UpdateBowDrawState();
-    void CheckForStateTransitions();
+private:
+    PenetratingLogic logic;
+    FrameGate updateGate; // Update() runs once per GameClock frame
     
-    PenetratingArrowHandler() = default;
+    // Registration with the player's animation graph, following it across rebuilds
+    PlayerGraphSink animationSink{ this, "PenetratingArrow" };
+
+    PenetratingArrowHandler();
     ~PenetratingArrowHandler() = default;
     PenetratingArrowHandler(const PenetratingArrowHandler&) = delete;
     PenetratingArrowHandler(PenetratingArrowHandler&&) = delete;
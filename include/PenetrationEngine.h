@@ -0,0 +1,84 @@
+#pragma once
+
+#include <RE/Skyrim.h>
+#include <SKSE/SKSE.h>
+#include <array>
+#include <atomic>
+#include <mutex>
+
+// ============================================
+// Multi-target penetration
+// ============================================
+// Hooks ArrowProjectile::AddImpact so tagged arrows can pass through up to
+// maxTargets actors, losing a fixed fraction of their power per hit. Untagged
+// arrows only pay for one relaxed atomic load before the original call while
+// nothing is tagged, and a lock-free scan of kMaxTaggedArrows pointers while
+// something is; only impacts of tagged arrows take the lock.
+// An arrow tagged with the actors predicted along its flight path (from the
+// ActorBroadphase) stops passing through once none of them is left unhit, so
+// the last actor in line is impaled as usual.
+class PenetrationEngine
+{
+public:
+    static PenetrationEngine* GetSingleton();
+
+    static void Install();
+
+    // Starts tracking an arrow; returns false if every slot is taken by a live arrow.
+    // inPath lists the actors predicted along the flight path, at most
+    // kMaxHitsPerArrow are kept; with none the arrow passes through until maxTargets.
+    bool Tag(RE::Projectile* projectile, int maxTargets, float damageFalloff, const RE::FormID* inPath = nullptr, std::size_t inPathCount = 0);
+    // Frees slots whose arrow was destroyed without a final impact, so the
+    // tagged count drops back to zero and the impact hook's fast path resumes.
+    // Called once per frame from FrameHook; free when nothing is tagged.
+    void ReclaimDead();
+    // Forgets every tagged arrow; the co-save revert calls this on load and new game
+    void Clear();
+
+    int GetTaggedCount() const { return taggedCount.load(std::memory_order_relaxed); }
+
+    static constexpr int kMaxTaggedArrows = 8;
+    static constexpr int kMaxHitsPerArrow = 8;
+
+private:
+    struct TaggedArrow {
+        RE::Projectile* projectile = nullptr;
+        RE::ProjectileHandle handle{};
+        std::array<RE::FormID, kMaxHitsPerArrow> hitActors{};  // small inline set, linear scan
+        std::array<RE::FormID, kMaxHitsPerArrow> inPath{};     // predicted targets
+        std::uint8_t hitCount = 0;
+        std::uint8_t inPathCount = 0;
+        std::uint8_t maxTargets = 0;
+        float basePower = 1.0f;
+        float damageFalloff = 1.0f;
+
+        bool HasHit(RE::FormID a_formID) const;
+        // True while a predicted target has not been hit yet, or when nothing was predicted
+        bool HasTargetsAhead() const;
+    };
+
+    // Lock-free check against the published slot pointers; a false positive
+    // (slot released meanwhile) is settled by OnImpact under the lock
+    bool MayBeTagged(const RE::Projectile* projectile) const;
+
+    // Returns true when the original impact should be skipped
+    bool OnImpact(RE::Projectile* projectile, RE::TESObjectREFR* ref, bool& passThrough);
+    void Release(TaggedArrow& arrow);
+    void ReclaimDeadLocked();
+
+    static void AddImpact(RE::Projectile* a_this, RE::TESObjectREFR* a_ref, const RE::NiPoint3& a_targetLoc, const RE::NiPoint3& a_velocity,
+                          RE::hkpCollidable* a_collidable, std::int32_t a_arg6, std::uint32_t a_arg7);
+    static inline REL::Relocation<decltype(AddImpact)> _AddImpact;
+
+    std::array<TaggedArrow, kMaxTaggedArrows> arrows{};
+    std::array<std::atomic<const RE::Projectile*>, kMaxTaggedArrows> published{};  // arrows[i].projectile, readable without the lock
+    std::atomic<int> taggedCount{ 0 };
+    std::mutex lock;
+
+    PenetrationEngine() = default;
+    ~PenetrationEngine() = default;
+    PenetrationEngine(const PenetrationEngine&) = delete;
+    PenetrationEngine(PenetrationEngine&&) = delete;
+    PenetrationEngine& operator=(const PenetrationEngine&) = delete;
+    PenetrationEngine& operator=(PenetrationEngine&&) = delete;
+};
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <RE/Skyrim.h>
+
+// ============================================
+// Player animation graph registration
+// ============================================
+// Keeps one handler registered with the player's current animation graph.
+// The game rebuilds the graph on load, race change and similar; Refresh
+// notices the new source and moves the sink across, and detaches while the
+// player has no graph. FrameHook refreshes both technique sinks every frame,
+// so a discarded graph is let go of within a frame. One reference to the
+// registered graph is held so the old source is still alive to be left and
+// the sink never ends up on two graphs at once.
+class PlayerGraphSink
+{
+public:
+    using Sink = RE::BSTEventSink<RE::BSAnimationGraphEvent>;
+
+    // owner prefixes the log lines
+    PlayerGraphSink(Sink* sink, const char* owner);
+    ~PlayerGraphSink();
+
+    PlayerGraphSink(const PlayerGraphSink&) = delete;
+    PlayerGraphSink(PlayerGraphSink&&) = delete;
+    PlayerGraphSink& operator=(const PlayerGraphSink&) = delete;
+    PlayerGraphSink& operator=(PlayerGraphSink&&) = delete;
+
+    // Registers with the player's current graph, leaving the previous one if
+    // it changed or is gone. Cheap when nothing changed. Returns true if now
+    // registered.
+    bool Refresh();
+
+    bool IsRegistered() const { return sink.registered(); }
+
+private:
+    using GraphRef = RE::BSTSmartPointerIntrusiveRefCount<RE::BShkbAnimationGraph>;
+
+    // Leaves the current graph and drops its reference; true if the sink was registered
+    bool Detach();
+
+    RE::ScopedSink<RE::BSAnimationGraphEvent> sink;
+    RE::BShkbAnimationGraph* graph = nullptr;  // one reference held, keeps sink.source() alive
+    const char* owner;
+};
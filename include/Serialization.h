@@ -0,0 +1,17 @@
+#pragma once
+
+#include <RE/Skyrim.h>
+#include <SKSE/SKSE.h>
+
+// ============================================
+// Co-save persistence
+// ============================================
+// Registers the SKSE serialization callbacks that save and restore technique
+// timers with the game's save, one TechniqueRecord per technique.
+namespace Serialization {
+    void Install();
+
+    void OnSave(SKSE::SerializationInterface* a_intfc);
+    void OnLoad(SKSE::SerializationInterface* a_intfc);
+    void OnRevert(SKSE::SerializationInterface* a_intfc);
+}
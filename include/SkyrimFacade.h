@@ -0,0 +1,40 @@
+#pragma once
+
+#include <RE/Skyrim.h>
+#include <SKSE/SKSE.h>
+#include "GameFacade.h"
+
+// ============================================
+// Skyrim game facade
+// ============================================
+// Game::Facade over the live game: facts come from the per-frame
+// ArcheryContext and GameClock, reports become log lines and on-screen
+// messages, and launches are queued as SKSE tasks on the handlers.
+class SkyrimFacade : public Game::Facade
+{
+public:
+    static SkyrimFacade* GetSingleton();
+
+    double GameTime() const override;
+    Game::Shooter GetShooter() const override;
+    std::uint32_t PlayerID() const override;
+
+    bool MeetsPerkRequirement(Game::Technique technique) const override;
+    int AmmoCount() const override;
+
+    bool IsDrawTracked() const override;
+    bool IsDrawing() const override;
+
+    void LaunchVolley(int arrowCount, int additionalArrows) override;
+    void LaunchPenetratingArrow() override;
+
+    void Report(Game::Event event, float value) override;
+
+private:
+    SkyrimFacade() = default;
+    ~SkyrimFacade() override = default;
+    SkyrimFacade(const SkyrimFacade&) = delete;
+    SkyrimFacade(SkyrimFacade&&) = delete;
+    SkyrimFacade& operator=(const SkyrimFacade&) = delete;
+    SkyrimFacade& operator=(SkyrimFacade&&) = delete;
+};
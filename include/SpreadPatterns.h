@@ -0,0 +1,173 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <string_view>
+
+// ============================================
+// Spread pattern library
+// ============================================
+// Every pattern is a table of offsets on the aim plane, one per arrow, with
+// slot 0 always reserved for the vanilla arrow fired straight along the aim.
+// Offsets are in units of tan(spread angle), so applying a pattern at
+// runtime is a single basis multiply per arrow:
+//
+//   direction = forward + tan(spread) * (offset.right * right + offset.up * up)
+//
+// Tables for every supported arrow count are generated at compile time.
+namespace SpreadPatterns {
+    enum class Pattern {
+        Fan,       // Horizontal line through the aim point
+        Vertical,  // Vertical line through the aim point
+        Cone,      // Two concentric rings around the aim point
+        Ring,      // Single ring around the aim point
+        Cross,     // Alternating horizontal and vertical arms
+
+        kTotal
+    };
+
+    constexpr int kMinArrows = 2;
+    constexpr int kMaxArrows = 10;
+
+    struct Offset {
+        float right = 0.0f;
+        float up = 0.0f;
+    };
+
+    using Table = std::array<Offset, kMaxArrows>;
+
+    namespace detail {
+        constexpr double kPi = 3.14159265358979323846;
+
+        // Taylor series after reducing to [-pi/2, pi/2]; accurate to double precision
+        constexpr double ConstSin(double x)
+        {
+            while (x > kPi) {
+                x -= 2.0 * kPi;
+            }
+            while (x < -kPi) {
+                x += 2.0 * kPi;
+            }
+            if (x > kPi / 2.0) {
+                x = kPi - x;
+            } else if (x < -kPi / 2.0) {
+                x = -kPi - x;
+            }
+
+            double term = x;
+            double sum = x;
+            for (int n = 1; n < 12; ++n) {
+                term *= -x * x / ((2.0 * n) * (2.0 * n + 1.0));
+                sum += term;
+            }
+            return sum;
+        }
+
+        constexpr double ConstCos(double x) { return ConstSin(x + kPi / 2.0); }
+
+        struct ConstTrig {
+            static constexpr double Sin(double x) { return ConstSin(x); }
+            static constexpr double Cos(double x) { return ConstCos(x); }
+        };
+
+        // Slot n >= 1 of a line pattern: -1, +1, -2, +2, ...
+        constexpr double LineStep(int slot) { return (slot % 2 == 1 ? -1.0 : 1.0) * static_cast<double>((slot + 1) / 2); }
+
+        // Point on a ring of `count` evenly spaced arrows starting at the top
+        template <class Trig>
+        constexpr Offset RingPoint(int index, int count, double radius, double phase)
+        {
+            double angle = phase + 2.0 * kPi * static_cast<double>(index) / static_cast<double>(count);
+            return { static_cast<float>(radius * Trig::Sin(angle)), static_cast<float>(radius * Trig::Cos(angle)) };
+        }
+    }
+
+    // Offset of one arrow slot; Trig supplies Sin/Cos so the same layout can be
+    // evaluated at compile time or against the runtime math library.
+    template <class Trig>
+    constexpr Offset ComputeOffset(Pattern pattern, int arrowCount, int slot)
+    {
+        if (slot <= 0 || slot >= arrowCount) {
+            return {};
+        }
+
+        int extras = arrowCount - 1;
+        switch (pattern) {
+        case Pattern::Fan:
+            return { static_cast<float>(detail::LineStep(slot)), 0.0f };
+        case Pattern::Vertical:
+            return { 0.0f, static_cast<float>(-detail::LineStep(slot)) };
+        case Pattern::Ring:
+            return detail::RingPoint<Trig>(slot - 1, extras, 1.0, 0.0);
+        case Pattern::Cone:
+            {
+                // Inner ring holds a third of the arrows at half radius, the rest go on the rim
+                int inner = extras < 4 ? 0 : (extras + 2) / 3;
+                int outer = extras - inner;
+                if (slot <= inner) {
+                    return detail::RingPoint<Trig>(slot - 1, inner, 0.5, detail::kPi / static_cast<double>(inner));
+                }
+                return detail::RingPoint<Trig>(slot - 1 - inner, outer, 1.0, 0.0);
+            }
+        case Pattern::Cross:
+            {
+                // Right, left, up, down, then the same one step further out
+                int arm = (slot - 1) % 4;
+                double reach = static_cast<double>((slot - 1) / 4 + 1);
+                constexpr double armRight[4] = { 1.0, -1.0, 0.0, 0.0 };
+                constexpr double armUp[4] = { 0.0, 0.0, 1.0, -1.0 };
+                return { static_cast<float>(armRight[arm] * reach), static_cast<float>(armUp[arm] * reach) };
+            }
+        default:
+            return {};
+        }
+    }
+
+    namespace detail {
+        using PatternTables = std::array<Table, kMaxArrows + 1>;
+
+        constexpr std::array<PatternTables, static_cast<std::size_t>(Pattern::kTotal)> GenerateTables()
+        {
+            std::array<PatternTables, static_cast<std::size_t>(Pattern::kTotal)> tables{};
+            for (std::size_t p = 0; p < tables.size(); ++p) {
+                for (int count = kMinArrows; count <= kMaxArrows; ++count) {
+                    for (int slot = 0; slot < count; ++slot) {
+                        tables[p][count][slot] = ComputeOffset<ConstTrig>(static_cast<Pattern>(p), count, slot);
+                    }
+                }
+            }
+            return tables;
+        }
+
+        inline constexpr auto kTables = GenerateTables();
+    }
+
+    constexpr const Table& GetTable(Pattern pattern, int arrowCount)
+    {
+        if (arrowCount < kMinArrows) {
+            arrowCount = kMinArrows;
+        } else if (arrowCount > kMaxArrows) {
+            arrowCount = kMaxArrows;
+        }
+        return detail::kTables[static_cast<std::size_t>(pattern)][arrowCount];
+    }
+
+    // Orthonormal aim frame; a pattern is applied by scaling right/up with tan(spread)
+    struct AimBasis {
+        float right[3];
+        float forward[3];
+        float up[3];
+    };
+
+    // Builds the aim frame from game angles (pitch positive down, yaw clockwise from +Y)
+    AimBasis MakeAimBasis(float pitch, float yaw);
+
+    // Unit world direction of one pattern slot
+    void ApplyOffset(const AimBasis& basis, float tanSpread, Offset offset, float (&direction)[3]);
+
+    // World direction back to game launch angles
+    void DirectionToAngles(const float (&direction)[3], float& pitch, float& yaw);
+
+    Pattern FromString(std::string_view name, Pattern fallback = Pattern::Fan);
+    std::string_view ToString(Pattern pattern);
+}
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// ============================================
+// Deferred main-thread tasks
+// ============================================
+// Replaces SKSE::TaskInterface::AddTask for the plugin's own deferred work.
+// AddTask boxes every lambda in a heap-allocated delegate; here a task is
+// moved into a fixed slot of a bounded ring, so captures up to kInlineBytes
+// cost no allocation. Any thread may Push (multiple producers, Vyukov-style
+// sequence numbers, no locks); FrameHook drains the ring once per frame on
+// the main thread (single consumer).
+class TaskQueue
+{
+public:
+    static constexpr std::size_t kCapacity = 256;  // power of two
+    static constexpr std::size_t kInlineBytes = 48;
+
+    static TaskQueue* GetSingleton();
+
+    TaskQueue();
+    // Pending tasks are destroyed without running
+    ~TaskQueue();
+
+    TaskQueue(const TaskQueue&) = delete;
+    TaskQueue(TaskQueue&&) = delete;
+    TaskQueue& operator=(const TaskQueue&) = delete;
+    TaskQueue& operator=(TaskQueue&&) = delete;
+
+    // Queues a callable for the next Drain; false if the ring is full, in which
+    // case the task is left untouched so the caller can fall back. Larger
+    // captures still work but are boxed on the heap (Metrics tasksBoxed).
+    template <class F>
+    bool Push(F&& task)
+    {
+        using Task = std::decay_t<F>;
+
+        auto pos = enqueuePos.load(std::memory_order_relaxed);
+        Slot* slot = nullptr;
+        for (;;) {
+            slot = &slots[pos & (kCapacity - 1)];
+            auto sequence = slot->sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos);
+            if (diff == 0) {
+                if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        if constexpr (sizeof(Task) <= kInlineBytes && alignof(Task) <= alignof(std::max_align_t)) {
+            ::new (static_cast<void*>(slot->storage)) Task(std::forward<F>(task));
+            slot->invoke = &Invoke<Task>;
+        } else {
+            ::new (static_cast<void*>(slot->storage)) Boxed<Task>{ std::make_unique<Task>(std::forward<F>(task)) };
+            slot->invoke = &Invoke<Boxed<Task>>;
+            OnBoxed();
+        }
+        slot->sequence.store(pos + 1, std::memory_order_release);
+        OnPushed(pos + 1);
+        return true;
+    }
+
+    // Runs the tasks queued before the call, in order; tasks they queue wait for
+    // the next Drain. Main thread only. Returns the number run.
+    std::size_t Drain();
+
+    // Tasks waiting, and the most that have waited at once
+    std::size_t Depth() const;
+    std::size_t PeakDepth() const { return peakDepth.load(std::memory_order_relaxed); }
+
+private:
+    struct alignas(64) Slot {
+        std::atomic<std::size_t> sequence{ 0 };
+        void (*invoke)(std::byte* storage, bool run) = nullptr;
+        alignas(std::max_align_t) std::byte storage[kInlineBytes];
+    };
+
+    template <class Task>
+    struct Boxed {
+        std::unique_ptr<Task> task;
+        void operator()() { (*task)(); }
+    };
+
+    // Runs the task if asked, then destroys it in place
+    template <class Task>
+    static void Invoke(std::byte* storage, bool run)
+    {
+        auto* task = std::launder(reinterpret_cast<Task*>(storage));
+        if (run) {
+            (*task)();
+        }
+        task->~Task();
+    }
+
+    void OnPushed(std::size_t enqueued);
+    void OnBoxed();
+
+    std::array<Slot, kCapacity> slots;
+    alignas(64) std::atomic<std::size_t> enqueuePos{ 0 };
+    alignas(64) std::atomic<std::size_t> dequeuePos{ 0 };
+    std::atomic<std::size_t> peakDepth{ 0 };
+};
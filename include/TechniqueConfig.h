@@ -0,0 +1,32 @@
+#pragma once
+
+#include "SpreadPatterns.h"
+
+// ============================================
+// Technique settings
+// ============================================
+// Plain settings structs shared by Config (which fills them from the INI) and
+// the game-free technique logic, so neither needs the other's headers.
+struct MultishotConfig {
+    bool enabled = true;
+    int arrowCount = 3;
+    float spreadAngle = 15.0f;
+    SpreadPatterns::Pattern spreadPattern = SpreadPatterns::Pattern::Fan;
+    int keyCode = 46; // 'C' key scan code
+    float readyWindowDuration = 5.0f; // Duration of ready state in seconds
+    float cooldownDuration = 20.0f; // Cooldown period in seconds
+    bool convergence = false; // Solve per-arrow angles so the volley converges at convergenceDistance
+    float convergenceDistance = 2048.0f; // Distance of the convergence pattern in game units
+    float convergenceSpacing = 64.0f; // Spacing between pattern points in game units (0 = single point)
+};
+
+struct PenetratingArrowConfig {
+    bool enabled = true;
+    float chargeTime = 3.0f; // Time to charge penetrating arrow in seconds
+    float cooldownDuration = 10.0f; // Cooldown period in seconds
+    float damageMultiplier = 2.0f; // Damage multiplier for penetrating arrows
+    float speedMultiplier = 1.5f; // Speed multiplier for penetrating arrows
+    int maxTargets = 3; // Number of actors a penetrating arrow can pass through
+    float damageFalloff = 0.75f; // Power retained after each actor hit
+    float fullDrawDistance = 50.0f; // VR: hand separation beyond the rest pose that counts as a full draw
+};
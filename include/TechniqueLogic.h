@@ -0,0 +1,166 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "DrawDetector.h"
+#include "GameFacade.h"
+#include "SpreadPatterns.h"
+#include "TechniqueConfig.h"
+#include "TechniqueRecord.h"
+
+enum class MultishotState {
+    Inactive,   // Normal state, multishot not available
+    Ready,      // Ready window active, next shot will be multishot
+    Cooldown    // Cooldown period, cannot activate ready state
+};
+
+enum class PenetratingArrowState {
+    Inactive,   // Normal state, not tracking bow draw
+    Drawing,    // Bow is being drawn
+    Charging,   // Bow is fully drawn, charging for penetrating shot
+    Charged,    // Arrow is charged and ready for penetrating shot
+    Cooldown    // Cooldown period after firing penetrating arrow
+};
+
+// ============================================
+// Technique state machines
+// ============================================
+// The decision logic of both techniques with every game access going through
+// Game::Facade. The handlers own one of each and forward game events to them;
+// the headless tests drive them directly against a mock facade.
+class MultishotLogic
+{
+public:
+    MultishotLogic(Game::Facade& game, const MultishotConfig& config);
+
+    // Key press: opens the ready window if nothing blocks it
+    bool TryActivate();
+    void Activate();
+    bool CanActivate();
+
+    // Vanilla arrow left the bow; returns true when a volley was requested
+    bool OnArrowRelease();
+
+    // Expires the ready window and ends the cooldown
+    void Update();
+
+    bool IsReady() const { return state == MultishotState::Ready; }
+    bool IsOnCooldown() const { return state == MultishotState::Cooldown; }
+    MultishotState GetState() const { return state; }
+    float GetRemainingReadyTime() const;
+    float GetRemainingCooldownTime() const;
+
+    // Co-save: the ready window or cooldown as seconds of play left
+    void Save(TechniqueRecord::Record& record) const;
+    void Load(const TechniqueRecord::Entry& entry);
+    void Revert();
+
+private:
+    float Since(double stamp) const;
+
+    Game::Facade& game;
+    const MultishotConfig& config;
+    MultishotState state = MultishotState::Inactive;
+    double readyStateStartTime = 0.0;  // Facade::GameTime() stamps
+    double cooldownStartTime = 0.0;
+};
+
+class PenetratingLogic
+{
+public:
+    PenetratingLogic(Game::Facade& game, const PenetratingArrowConfig& config, const MultishotLogic& multishot);
+
+    void OnBowDrawStart();
+    void OnBowDrawStop();
+    void OnDrawFrame(float drawStrength, float delta); // VR: charge weighted by draw strength
+    void OnArrowRelease();
+
+    // Per-frame draw checks followed by the timed transitions
+    void Update();
+
+    void StartCharging();
+    void ResetState();
+    bool CanStartCharging() const;
+
+    bool IsCharged() const { return state == PenetratingArrowState::Charged; }
+    bool IsCharging() const { return state == PenetratingArrowState::Charging; }
+    bool IsOnCooldown() const { return state == PenetratingArrowState::Cooldown; }
+    PenetratingArrowState GetState() const { return state; }
+    float GetChargingProgress() const; // 0.0-1.0
+    float GetRemainingCooldownTime() const;
+
+    // Co-save: only the cooldown survives a load; a charge needs the bow held
+    void Save(TechniqueRecord::Record& record) const;
+    void Load(const TechniqueRecord::Entry& entry);
+    void Revert();
+
+private:
+    void UpdateBowDrawState();
+    void CheckForStateTransitions();
+    float Since(double stamp) const;
+
+    // Bow draw events fire every ~500-700ms while drawing; a longer gap means the draw was let down
+    static constexpr float kDrawEventTimeout = 2.0f;
+
+    Game::Facade& game;
+    const PenetratingArrowConfig& config;
+    const MultishotLogic& multishot;
+    PenetratingArrowState state = PenetratingArrowState::Inactive;
+    double chargingStartTime = 0.0;  // Facade::GameTime() stamps
+    double cooldownStartTime = 0.0;
+    double lastBowDrawTime = 0.0;
+    DrawDetector::ChargeIntegrator chargeIntegrator;
+};
+
+// ============================================
+// Volley layout
+// ============================================
+// Launch origin and angles of every extra arrow in a multishot volley, from
+// the vanilla arrow's origin and angles. Slot 0 of the pattern is the vanilla
+// arrow, so a volley of arrowCount holds arrowCount - 1 arrows.
+namespace Volley {
+    struct Input {
+        float origin[3] = {};
+        float pitch = 0.0f;          // vanilla launch angles, radians
+        float yaw = 0.0f;
+        float cameraRight[3] = {};   // origin offsets follow the camera so arrows do not collide
+        float cameraUp[3] = {};
+        int arrowCount = 0;
+        float projectileSpeed = 0.0f;   // 0 when the ammo has no projectile; convergence is skipped
+        float projectileGravity = 0.0f; // game units / s^2
+    };
+
+    struct Layout {
+        int count = 0;
+        std::array<int, SpreadPatterns::kMaxArrows> slots{};
+        std::array<std::array<float, 3>, SpreadPatterns::kMaxArrows> origins{};
+        std::array<float, SpreadPatterns::kMaxArrows> pitch{};
+        std::array<float, SpreadPatterns::kMaxArrows> yaw{};
+        std::size_t unreachable = 0;     // convergence points out of range
+        bool convergenceSkipped = false; // convergence requested but the ammo has no projectile
+    };
+
+    // Origins are offset this many units per pattern step from the vanilla origin
+    constexpr float kOriginSpacing = 5.0f;
+
+    Layout Compute(const Input& input, const MultishotConfig& config);
+
+    // Puts one arrow of a laid-out volley into the world: the plugin launches a
+    // projectile, the mock game counts it. Returns false if the launch failed.
+    class Launcher
+    {
+    public:
+        virtual ~Launcher() = default;
+        virtual bool Launch(int slot, const std::array<float, 3>& origin, float pitch, float yaw) = 0;
+    };
+
+    struct Result {
+        Layout layout;
+        int launched = 0;
+    };
+
+    // Lays out the volley and launches its arrows in slot order. Everything
+    // lives in the fixed-size Layout, so a volley never touches the heap.
+    Result Fire(const Input& input, const MultishotConfig& config, Launcher& launcher);
+}
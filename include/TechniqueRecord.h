@@ -0,0 +1,63 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// ============================================
+// Co-save technique records
+// ============================================
+// Fixed binary layout for technique state stored in the SKSE co-save. Each
+// technique writes one record: a count followed by that many per-actor
+// entries, straight out of a fixed-capacity buffer. Timers are stored as the
+// seconds of play left, so time spent with the game closed or paused does
+// not count against them.
+//
+// These are GameClock play seconds, not in-game hours. The technique timers
+// and their INI durations are both play seconds. Storing timescale-scaled
+// game time would make a timescale change between save and load stretch or
+// shrink a restored cooldown, and the live timers would not agree with it.
+namespace TechniqueRecord {
+    constexpr std::uint32_t MakeType(char a, char b, char c, char d)
+    {
+        return (static_cast<std::uint32_t>(static_cast<std::uint8_t>(a)) << 24) |
+               (static_cast<std::uint32_t>(static_cast<std::uint8_t>(b)) << 16) |
+               (static_cast<std::uint32_t>(static_cast<std::uint8_t>(c)) << 8) |
+               static_cast<std::uint32_t>(static_cast<std::uint8_t>(d));
+    }
+
+    constexpr std::uint32_t kUniqueID = MakeType('A', 'R', 'C', 'H');
+    constexpr std::uint32_t kMultishotType = MakeType('M', 'S', 'H', 'T');
+    constexpr std::uint32_t kPenetratingArrowType = MakeType('P', 'N', 'A', 'R');
+    constexpr std::uint32_t kVersion = 1;
+
+    // Upper bound on actors per technique; extra entries in a save are skipped on load
+    constexpr std::size_t kMaxEntries = 128;
+
+    struct Entry {
+        std::uint32_t actor = 0;      // FormID, resolved through the co-save on load
+        std::uint8_t state = 0;       // technique-specific state enum
+        std::uint8_t pad05[3]{};
+        float remaining = 0.0f;       // seconds of play left on the active timer
+    };
+    static_assert(sizeof(Entry) == 12);
+
+    struct Record {
+        std::uint32_t count = 0;
+        std::array<Entry, kMaxEntries> entries{};
+
+        // Returns false when the record is full
+        bool Add(const Entry& entry);
+        void Clear() { count = 0; }
+
+        // Bytes to write: the count plus the used entries only
+        std::uint32_t ByteSize() const;
+    };
+    static_assert(offsetof(Record, entries) == sizeof(std::uint32_t));
+
+    // Number of entries to read for a stored count, bounded by the record length and kMaxEntries
+    std::uint32_t ReadableCount(std::uint32_t storedCount, std::uint32_t recordLength);
+
+    // Remaining time clamped to [0, duration], so a shortened INI duration applies to old saves
+    float ClampRemaining(float remaining, float duration);
+}
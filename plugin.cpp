@@ -3,9 +3,17 @@
 #include <spdlog/sinks/basic_file_sink.h>
 #include <thread>
 
+#include "ArcheryContext.h"
 #include "Config.h"
+#include "ConsoleCommands.h"
+#include "EventRecorder.h"
+#include "FrameHook.h"
 #include "MultishotHandler.h"
 #include "PenetratingArrowHandler.h"
+#include "PenetrationEngine.h"
+#include "Serialization.h"
+#include "Trace.h"
+#include <cstdlib>
 
 using namespace std::literals;
 
@@ -89,23 +97,31 @@ void OnSKSEMessage(SKSE::MessagingInterface::Message* message) {
 
         auto* config = Config::GetSingleton();
         config->LoadFromINI();
+        EventRecorder::GetSingleton()->Start();
+        ConsoleCommands::Install();
+        if (config->traceZones) {
+            Trace::SetEnabled(true);
+            Trace::SetThreadName("Main thread");
+            std::atexit(ConsoleCommands::ExportTrace);
+            SKSE::log::info("Profiling zones enabled, the trace is written on ArcheryStats and at exit");
+        }
+
+        ArcheryContextService::GetSingleton()->Register();
         
 
         auto* inputDeviceManager = RE::BSInputDeviceManager::GetSingleton();
         if (inputDeviceManager) {
-            inputDeviceManager->AddEventSink(MultishotHandler::GetSingleton());
+            // Both technique handlers listen to input; add them under one lock of the source
+            RE::BSTEventSink<RE::InputEvent*>* inputSinks[] = {
+                MultishotHandler::GetSingleton(),
+                PenetratingArrowHandler::GetSingleton()
+            };
+            inputDeviceManager->AddEventSinks(inputSinks);
             SKSE::log::info("Multishot input handler registered");
+            SKSE::log::info("Penetrating arrow handler registered for input events");
         } else {
             SKSE::log::error("Failed to get BSInputDeviceManager singleton");
         }
-
-
-        auto* eventSource = RE::BSInputDeviceManager::GetSingleton();
-        if (eventSource) {
-
-            eventSource->AddEventSink(PenetratingArrowHandler::GetSingleton());
-            SKSE::log::info("Penetrating arrow handler registered for input events");
-        }
         
         SKSE::log::info("Penetrating arrow handler initialized independently");
 
@@ -126,6 +142,10 @@ SKSEPluginLoad(const SKSE::LoadInterface* skse) {
     SKSE::log::info("{} {} is loading...", plugin->GetName(), version);
     SKSE::Init(skse);
 
+    PenetrationEngine::Install();
+    FrameHook::Install();
+    Serialization::Install();
+
     // Register for SKSE messages
     auto* messaging = SKSE::GetMessagingInterface();
     if (messaging) {
@@ -0,0 +1,82 @@
+#include "ActorBroadphase.h"
+#include "GameClock.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+ActorBroadphase* ActorBroadphase::GetSingleton()
+{
+    static ActorBroadphase singleton;
+    return &singleton;
+}
+
+void ActorBroadphase::Refresh()
+{
+    // One rebuild per frame is enough for every query made within it
+    auto frame = GameClock::GetSingleton()->FrameNumber();
+    if (frame == lastRefreshFrame) {
+        return;
+    }
+    lastRefreshFrame = frame;
+
+    auto* processLists = RE::ProcessLists::GetSingleton();
+    if (!processLists) {
+        grid.Clear();
+        return;
+    }
+
+    entries.clear();
+    formIDs.clear();
+
+    // The inlined overload, so the walk costs no std::function call per actor
+    processLists->ForEachHighActor([this](RE::Actor* actor) {
+        if (actor->IsDead()) {
+            return RE::BSContainer::ForEachResult::kContinue;
+        }
+
+        // Sphere around the torso: centre at half height, radius from the bound extents
+        auto position = actor->GetPosition();
+        auto boundMax = actor->GetBoundMax();
+        float halfHeight = actor->GetHeight() * 0.5f;
+        float radius = std::max({ std::abs(boundMax.x), std::abs(boundMax.y), halfHeight });
+
+        formIDs.push_back(actor->GetFormID());
+        entries.push_back({ static_cast<std::uint32_t>(formIDs.size()), position.x, position.y, position.z + halfHeight, radius });
+        return RE::BSContainer::ForEachResult::kContinue;
+    });
+
+    grid.Update(entries);
+}
+
+std::size_t ActorBroadphase::ResolveHits(const std::uint32_t* ids, std::size_t count, RE::FormID* out, std::size_t maxOut) const
+{
+    std::size_t written = 0;
+    for (std::size_t i = 0; i < count && written < maxOut; ++i) {
+        out[written++] = formIDs[ids[i] - 1];
+    }
+    return written;
+}
+
+std::size_t ActorBroadphase::QueryRay(const RE::NiPoint3& origin, const RE::NiPoint3& direction, float length,
+                                      RE::FormID* out, std::size_t maxOut)
+{
+    Refresh();
+
+    std::array<std::uint32_t, kMaxResults> ids;
+    float from[3] = { origin.x, origin.y, origin.z };
+    float dir[3] = { direction.x, direction.y, direction.z };
+    auto count = grid.QueryRay(from, dir, length, ids.data(), std::min(maxOut, ids.size()));
+    return ResolveHits(ids.data(), count, out, maxOut);
+}
+
+std::size_t ActorBroadphase::QueryCapsule(const RE::NiPoint3& a, const RE::NiPoint3& b, float radius,
+                                          RE::FormID* out, std::size_t maxOut)
+{
+    Refresh();
+
+    std::array<std::uint32_t, kMaxResults> ids;
+    float from[3] = { a.x, a.y, a.z };
+    float to[3] = { b.x, b.y, b.z };
+    auto count = grid.QueryCapsule(from, to, radius, ids.data(), std::min(maxOut, ids.size()));
+    return ResolveHits(ids.data(), count, out, maxOut);
+}
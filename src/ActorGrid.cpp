@@ -0,0 +1,185 @@
+#include "ActorGrid.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    constexpr std::int32_t kCoordLimit = 32767;
+
+    std::uint32_t PackCell(std::int32_t cx, std::int32_t cy)
+    {
+        return (static_cast<std::uint32_t>(cx + 32768) << 16) | static_cast<std::uint32_t>(cy + 32768);
+    }
+
+    float DistanceSqToSegment(const float (&p)[3], const float (&a)[3], const float (&b)[3])
+    {
+        float ab[3] = { b[0] - a[0], b[1] - a[1], b[2] - a[2] };
+        float ap[3] = { p[0] - a[0], p[1] - a[1], p[2] - a[2] };
+        float lengthSq = ab[0] * ab[0] + ab[1] * ab[1] + ab[2] * ab[2];
+        float t = lengthSq > 0.0f ? (ap[0] * ab[0] + ap[1] * ab[1] + ap[2] * ab[2]) / lengthSq : 0.0f;
+        t = std::clamp(t, 0.0f, 1.0f);
+
+        float d[3] = { ap[0] - ab[0] * t, ap[1] - ab[1] * t, ap[2] - ab[2] * t };
+        return d[0] * d[0] + d[1] * d[1] + d[2] * d[2];
+    }
+}
+
+ActorGrid::ActorGrid(float cellSize) :
+    cellSize(cellSize),
+    inverseCellSize(1.0f / cellSize)
+{
+}
+
+std::int32_t ActorGrid::CellCoord(float value) const
+{
+    auto coord = static_cast<std::int32_t>(std::floor(value * inverseCellSize));
+    return std::clamp(coord, -kCoordLimit, kCoordLimit);
+}
+
+std::uint32_t ActorGrid::CellKey(float x, float y) const
+{
+    return PackCell(CellCoord(x), CellCoord(y));
+}
+
+void ActorGrid::Clear()
+{
+    entries.clear();
+    cellKeys.clear();
+    cellStart.clear();
+    maxRadius = 0.0f;
+    lastUpdateMoves = 0;
+}
+
+void ActorGrid::Update(std::span<const Entry> actors)
+{
+    scratch.clear();
+    scratch.reserve(actors.size());
+    maxRadius = 0.0f;
+
+    // Start from last frame's sorted order when the actor list is the same length,
+    // so only actors that crossed a cell boundary are out of place
+    bool reuseOrder = actors.size() == entries.size();
+    for (std::size_t i = 0; i < actors.size(); ++i) {
+        auto source = reuseOrder ? entries[i].source : static_cast<std::uint32_t>(i);
+        const auto& actor = actors[source];
+        scratch.push_back({ CellKey(actor.x, actor.y), source, actor });
+        maxRadius = std::max(maxRadius, actor.radius);
+    }
+
+    auto byCell = [](const Slot& lhs, const Slot& rhs) { return lhs.cell < rhs.cell; };
+
+    std::size_t descents = 0;
+    for (std::size_t i = 1; i < scratch.size(); ++i) {
+        descents += scratch[i].cell < scratch[i - 1].cell ? 1 : 0;
+    }
+
+    lastUpdateMoves = 0;
+    if (!reuseOrder || descents * 8 > scratch.size()) {
+        std::sort(scratch.begin(), scratch.end(), byCell);
+        lastUpdateMoves = scratch.size();
+    } else if (descents > 0) {
+        // Nearly sorted - insertion sort touches only the actors that moved cells
+        for (std::size_t i = 1; i < scratch.size(); ++i) {
+            auto slot = scratch[i];
+            std::size_t j = i;
+            while (j > 0 && scratch[j - 1].cell > slot.cell) {
+                scratch[j] = scratch[j - 1];
+                --j;
+                ++lastUpdateMoves;
+            }
+            scratch[j] = slot;
+        }
+    }
+
+    entries.swap(scratch);
+
+    cellKeys.clear();
+    cellStart.clear();
+    for (std::size_t i = 0; i < entries.size(); ++i) {
+        if (cellKeys.empty() || cellKeys.back() != entries[i].cell) {
+            cellKeys.push_back(entries[i].cell);
+            cellStart.push_back(static_cast<std::uint32_t>(i));
+        }
+    }
+    cellStart.push_back(static_cast<std::uint32_t>(entries.size()));
+}
+
+bool ActorGrid::Touches(const Entry& entry, const float (&a)[3], const float (&b)[3], float radius)
+{
+    float p[3] = { entry.x, entry.y, entry.z };
+    float reach = radius + entry.radius;
+    return DistanceSqToSegment(p, a, b) <= reach * reach;
+}
+
+std::size_t ActorGrid::QueryCapsule(const float (&a)[3], const float (&b)[3], float radius, std::uint32_t* out, std::size_t maxOut) const
+{
+    if (entries.empty()) {
+        return 0;
+    }
+
+    std::size_t found = 0;
+    float reach = radius + maxRadius;
+    float dx = b[0] - a[0];
+    float dy = b[1] - a[1];
+
+    std::int32_t columnBegin = CellCoord(std::min(a[0], b[0]) - reach);
+    std::int32_t columnEnd = CellCoord(std::max(a[0], b[0]) + reach);
+
+    for (std::int32_t cx = columnBegin; cx <= columnEnd && found < maxOut; ++cx) {
+        // Clip the segment to this column's slab (widened by reach) to get the rows it sweeps
+        float slabMin = static_cast<float>(cx) * cellSize - reach;
+        float slabMax = static_cast<float>(cx + 1) * cellSize + reach;
+        float t0 = 0.0f;
+        float t1 = 1.0f;
+        if (std::abs(dx) > 1.0e-6f) {
+            float ta = (slabMin - a[0]) / dx;
+            float tb = (slabMax - a[0]) / dx;
+            t0 = std::max(t0, std::min(ta, tb));
+            t1 = std::min(t1, std::max(ta, tb));
+            if (t0 > t1) {
+                continue;
+            }
+        } else if (a[0] < slabMin || a[0] > slabMax) {
+            continue;
+        }
+
+        float y0 = a[1] + dy * t0;
+        float y1 = a[1] + dy * t1;
+        std::uint32_t firstKey = PackCell(cx, CellCoord(std::min(y0, y1) - reach));
+        std::uint32_t lastKey = PackCell(cx, CellCoord(std::max(y0, y1) + reach));
+
+        // Cells of one column are contiguous in key order
+        auto cell = std::lower_bound(cellKeys.begin(), cellKeys.end(), firstKey);
+        for (; cell != cellKeys.end() && *cell <= lastKey; ++cell) {
+            auto index = static_cast<std::size_t>(cell - cellKeys.begin());
+            for (auto i = cellStart[index]; i < cellStart[index + 1]; ++i) {
+                if (Touches(entries[i].entry, a, b, radius)) {
+                    out[found++] = entries[i].entry.id;
+                    if (found == maxOut) {
+                        return found;
+                    }
+                }
+            }
+        }
+    }
+    return found;
+}
+
+std::size_t ActorGrid::QueryRay(const float (&origin)[3], const float (&direction)[3], float length, std::uint32_t* out, std::size_t maxOut) const
+{
+    float end[3] = { origin[0] + direction[0] * length, origin[1] + direction[1] * length, origin[2] + direction[2] * length };
+    return QueryCapsule(origin, end, 0.0f, out, maxOut);
+}
+
+std::size_t ActorGrid::QueryCapsuleBruteForce(const float (&a)[3], const float (&b)[3], float radius, std::uint32_t* out, std::size_t maxOut) const
+{
+    std::size_t found = 0;
+    for (const auto& slot : entries) {
+        if (found == maxOut) {
+            break;
+        }
+        if (Touches(slot.entry, a, b, radius)) {
+            out[found++] = slot.entry.id;
+        }
+    }
+    return found;
+}
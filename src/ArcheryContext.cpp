@@ -0,0 +1,102 @@
+#include "ArcheryContext.h"
+#include "GameClock.h"
+#include "Trace.h"
+
+ArcheryContextService* ArcheryContextService::GetSingleton()
+{
+    static ArcheryContextService singleton;
+    return &singleton;
+}
+
+const ArcheryContext& ArcheryContextService::Get()
+{
+    return GetSingleton()->Current();
+}
+
+void ArcheryContextService::Register()
+{
+    if (auto* scriptEvents = RE::ScriptEventSourceHolder::GetSingleton()) {
+        scriptEvents->AddEventSink<RE::TESEquipEvent>(this);
+    }
+    if (auto* ui = RE::UI::GetSingleton()) {
+        ui->AddEventSink<RE::MenuOpenCloseEvent>(this);
+    }
+    SKSE::log::info("ArcheryContext: Registered for equip and menu events");
+}
+
+void ArcheryContextService::OnFrameStart(std::uint64_t frame)
+{
+    if (frame == countersFrame) {
+        return;
+    }
+
+    totalSavedCalls += GetSavedCallsThisFrame();
+
+    // Report the frame that just ended every ~10 seconds at 90 fps
+    if (countersFrame % 900 == 0 && readsThisFrame > 0) {
+        SKSE::log::debug("ArcheryContext: Frame {} - {} reads, {} builds, {} game calls saved ({} total)",
+                         countersFrame, readsThisFrame, buildsThisFrame, GetSavedCallsThisFrame(), totalSavedCalls);
+    }
+
+    countersFrame = frame;
+    readsThisFrame = 0;
+    buildsThisFrame = 0;
+}
+
+void ArcheryContextService::Rebuild()
+{
+    auto frame = GameClock::GetSingleton()->FrameNumber();
+    OnFrameStart(frame);
+    ++buildsThisFrame;
+
+    ArcheryContext next;
+    next.frame = frame;
+    next.player = RE::PlayerCharacter::GetSingleton();
+    if (next.player) {
+        next.inKillMove = next.player->IsInKillMove();
+        next.isDead = next.player->IsDead();
+
+        auto* equippedWeapon = next.player->GetEquippedObject(false);
+        next.weapon = equippedWeapon ? equippedWeapon->As<RE::TESObjectWEAP>() : nullptr;
+        next.hasBow = next.weapon && next.weapon->GetWeaponType() == RE::WEAPON_TYPE::kBow;
+        next.ammo = next.player->GetCurrentAmmo();
+    }
+
+    auto* ui = RE::UI::GetSingleton();
+    next.gamePaused = ui && ui->GameIsPaused();
+
+    context = next;
+}
+
+const ArcheryContext& ArcheryContextService::Current()
+{
+    OnFrameStart(GameClock::GetSingleton()->FrameNumber());
+    ++readsThisFrame;
+    return context;
+}
+
+std::uint32_t ArcheryContextService::GetSavedCallsThisFrame() const
+{
+    return readsThisFrame > buildsThisFrame ? (readsThisFrame - buildsThisFrame) * kGameCallsPerBuild : 0;
+}
+
+RE::BSEventNotifyControl ArcheryContextService::ProcessEvent(const RE::TESEquipEvent* a_event,
+                                                             RE::BSTEventSource<RE::TESEquipEvent>* /*a_eventSource*/)
+{
+    Trace::Zone zone("ArcheryContext::ProcessEvent(Equip)");
+    if (a_event && a_event->actor && a_event->actor.get() == RE::PlayerCharacter::GetSingleton()) {
+        Rebuild();
+    }
+    return RE::BSEventNotifyControl::kContinue;
+}
+
+RE::BSEventNotifyControl ArcheryContextService::ProcessEvent(const RE::MenuOpenCloseEvent* a_event,
+                                                             RE::BSTEventSource<RE::MenuOpenCloseEvent>* /*a_eventSource*/)
+{
+    Trace::Zone zone("ArcheryContext::ProcessEvent(Menu)");
+    // Pausing menus stop the frame hook, so the paused flag has to be refreshed here
+    if (a_event) {
+        Rebuild();
+    }
+    return RE::BSEventNotifyControl::kContinue;
+}
@@ -0,0 +1,170 @@
+#include "Ballistics.h"
+#include "FastTrig.h"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+#if defined(_M_X64) || defined(__SSE2__)
+    #define BALLISTICS_HAS_SSE 1
+    #include <immintrin.h>
+#endif
+
+namespace Ballistics {
+    namespace {
+        // Minimum horizontal distance, avoids dividing by zero for straight up/down shots
+        constexpr float kMinHorizontal = 1.0e-3f;
+
+        // Low-arc elevation written in the cancellation-free form
+        //   tan = (g*h^2 + 2*dz*v^2) / (h * (v^2 + sqrt(disc)))
+        // which degrades gracefully to dz/h as gravity goes to zero.
+        bool SolveLane(float dx, float dy, float dz, float v2, float gravity, float& tanElevation)
+        {
+            float h2 = dx * dx + dy * dy;
+            float h = std::sqrt(std::max(h2, kMinHorizontal * kMinHorizontal));
+            float disc = v2 * v2 - gravity * (gravity * h2 + 2.0f * dz * v2);
+
+            if (disc < 0.0f) {
+                // Out of range - use the elevation that reaches furthest toward the target
+                tanElevation = v2 / (gravity * h);
+                return false;
+            }
+
+            tanElevation = (gravity * h2 + 2.0f * dz * v2) / (h * (v2 + std::sqrt(disc)));
+            return true;
+        }
+
+        // SIMD kernels leave tan(elevation) in pitch[]; convert to game angles here
+        void FinishAngles(const ConvergenceBatch& batch, std::size_t begin, std::size_t end)
+        {
+            for (std::size_t i = begin; i < end; ++i) {
+                batch.pitch[i] = -batch.pitch[i];
+            }
+            FastTrig::Atan(batch.pitch + begin, batch.pitch + begin, end - begin);
+            FastTrig::Atan2(batch.dx + begin, batch.dy + begin, batch.yaw + begin, end - begin);
+        }
+
+        std::size_t SolveScalarRange(const ConvergenceBatch& batch, std::size_t begin, float v2, float gravity)
+        {
+            std::size_t unreachable = 0;
+            for (std::size_t i = begin; i < batch.count; ++i) {
+                float tanElevation;
+                if (!SolveLane(batch.dx[i], batch.dy[i], batch.dz[i], v2, gravity, tanElevation)) {
+                    ++unreachable;
+                }
+                batch.pitch[i] = FastTrig::Atan(-tanElevation);
+                batch.yaw[i] = FastTrig::Atan2(batch.dx[i], batch.dy[i]);
+            }
+            return unreachable;
+        }
+
+#ifdef BALLISTICS_HAS_SSE
+        std::size_t SolveSSERange(const ConvergenceBatch& batch, std::size_t begin, std::size_t end, float v2, float gravity)
+        {
+            const __m128 vV2 = _mm_set1_ps(v2);
+            const __m128 vV4 = _mm_set1_ps(v2 * v2);
+            const __m128 vG = _mm_set1_ps(gravity);
+            const __m128 vTwoV2 = _mm_set1_ps(2.0f * v2);
+            const __m128 vMinH2 = _mm_set1_ps(kMinHorizontal * kMinHorizontal);
+            const __m128 vZero = _mm_setzero_ps();
+
+            std::size_t unreachable = 0;
+            std::size_t i = begin;
+            for (; i + 4 <= end; i += 4) {
+                __m128 dx = _mm_loadu_ps(batch.dx + i);
+                __m128 dy = _mm_loadu_ps(batch.dy + i);
+                __m128 dz = _mm_loadu_ps(batch.dz + i);
+
+                __m128 h2 = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+                __m128 h = _mm_sqrt_ps(_mm_max_ps(h2, vMinH2));
+                __m128 lift = _mm_add_ps(_mm_mul_ps(vG, h2), _mm_mul_ps(vTwoV2, dz));
+                __m128 disc = _mm_sub_ps(vV4, _mm_mul_ps(vG, lift));
+
+                __m128 outOfRange = _mm_cmplt_ps(disc, vZero);
+                __m128 root = _mm_sqrt_ps(_mm_max_ps(disc, vZero));
+                __m128 inRangeTan = _mm_div_ps(lift, _mm_mul_ps(h, _mm_add_ps(vV2, root)));
+                __m128 maxRangeTan = _mm_div_ps(vV2, _mm_mul_ps(vG, h));
+
+                __m128 tanElevation = _mm_or_ps(_mm_and_ps(outOfRange, maxRangeTan), _mm_andnot_ps(outOfRange, inRangeTan));
+                _mm_storeu_ps(batch.pitch + i, tanElevation);
+
+                unreachable += static_cast<std::size_t>(std::popcount(static_cast<unsigned>(_mm_movemask_ps(outOfRange))));
+            }
+            FinishAngles(batch, begin, i);
+            return unreachable + (i < end ? SolveScalarRange(batch, i, v2, gravity) : 0);
+        }
+#endif
+
+#ifdef __AVX__
+        std::size_t SolveAVXRange(const ConvergenceBatch& batch, float v2, float gravity)
+        {
+            const __m256 vV2 = _mm256_set1_ps(v2);
+            const __m256 vV4 = _mm256_set1_ps(v2 * v2);
+            const __m256 vG = _mm256_set1_ps(gravity);
+            const __m256 vTwoV2 = _mm256_set1_ps(2.0f * v2);
+            const __m256 vMinH2 = _mm256_set1_ps(kMinHorizontal * kMinHorizontal);
+            const __m256 vZero = _mm256_setzero_ps();
+
+            std::size_t unreachable = 0;
+            std::size_t i = 0;
+            for (; i + 8 <= batch.count; i += 8) {
+                __m256 dx = _mm256_loadu_ps(batch.dx + i);
+                __m256 dy = _mm256_loadu_ps(batch.dy + i);
+                __m256 dz = _mm256_loadu_ps(batch.dz + i);
+
+                __m256 h2 = _mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy));
+                __m256 h = _mm256_sqrt_ps(_mm256_max_ps(h2, vMinH2));
+                __m256 lift = _mm256_add_ps(_mm256_mul_ps(vG, h2), _mm256_mul_ps(vTwoV2, dz));
+                __m256 disc = _mm256_sub_ps(vV4, _mm256_mul_ps(vG, lift));
+
+                __m256 outOfRange = _mm256_cmp_ps(disc, vZero, _CMP_LT_OQ);
+                __m256 root = _mm256_sqrt_ps(_mm256_max_ps(disc, vZero));
+                __m256 inRangeTan = _mm256_div_ps(lift, _mm256_mul_ps(h, _mm256_add_ps(vV2, root)));
+                __m256 maxRangeTan = _mm256_div_ps(vV2, _mm256_mul_ps(vG, h));
+
+                _mm256_storeu_ps(batch.pitch + i, _mm256_blendv_ps(inRangeTan, maxRangeTan, outOfRange));
+
+                unreachable += static_cast<std::size_t>(std::popcount(static_cast<unsigned>(_mm256_movemask_ps(outOfRange))));
+            }
+            FinishAngles(batch, 0, i);
+            return unreachable + (i < batch.count ? SolveSSERange(batch, i, batch.count, v2, gravity) : 0);
+        }
+#endif
+    }
+
+    std::size_t SolveScalar(const ConvergenceBatch& batch, float speed, float gravity)
+    {
+        return SolveScalarRange(batch, 0, speed * speed, gravity);
+    }
+
+    std::size_t SolveSSE(const ConvergenceBatch& batch, float speed, float gravity)
+    {
+#ifdef BALLISTICS_HAS_SSE
+        return SolveSSERange(batch, 0, batch.count, speed * speed, gravity);
+#else
+        return SolveScalar(batch, speed, gravity);
+#endif
+    }
+
+    std::size_t SolveAVX(const ConvergenceBatch& batch, float speed, float gravity)
+    {
+#ifdef __AVX__
+        return SolveAVXRange(batch, speed * speed, gravity);
+#else
+        return SolveSSE(batch, speed, gravity);
+#endif
+    }
+
+    bool HasAVX()
+    {
+#ifdef __AVX__
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    std::size_t Solve(const ConvergenceBatch& batch, float speed, float gravity)
+    {
+        return HasAVX() ? SolveAVX(batch, speed, gravity) : SolveSSE(batch, speed, gravity);
+    }
+}
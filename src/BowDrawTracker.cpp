@@ -0,0 +1,91 @@
+#include "BowDrawTracker.h"
+#include "Config.h"
+#include "EventRecorder.h"
+#include "PenetratingArrowHandler.h"
+#include <algorithm>
+#include <array>
+#include <format>
+
+BowDrawTracker* BowDrawTracker::GetSingleton()
+{
+    static BowDrawTracker singleton;
+    return &singleton;
+}
+
+void BowDrawTracker::Sample(RE::PlayerCharacter* player, float delta)
+{
+    auto* vrData = player->GetVRNodeData();
+    if (!vrData) {
+        active = false;
+        return;
+    }
+    active = true;
+
+    DrawDetector::Sample sample;
+    sample.arrowKnocked = vrData->bowState == RE::VR_Bow_State::kArrowKnocked;
+    sample.drawAmount = vrData->currentBowDrawAmount;
+    if (vrData->NPCLHnd && vrData->NPCRHnd) {
+        sample.handDistance = vrData->NPCLHnd->world.translate.GetDistance(vrData->NPCRHnd->world.translate);
+    }
+    lastSample = sample;
+    lastDelta = delta;
+
+    auto edge = detector.Step(sample);
+    if (edge == DrawDetector::Edge::Started) {
+        // Knocking puts the hands together; measure the pull from the last frame
+        // before the edge, since by the edge frame the pull is already under way
+        const auto* before = history.Newest();
+        restDistance = before ? before->handDistance : sample.handDistance;
+        history.Clear();
+    }
+    drawStrength = detector.IsDrawing() ?
+                       DrawDetector::ComputeStrength(sample.handDistance, restDistance, Config::GetSingleton()->penetratingArrow.fullDrawDistance) :
+                       0.0f;
+    if (detector.IsDrawing() || edge == DrawDetector::Edge::Stopped) {
+        history.Push({ drawStrength, sample.drawAmount, sample.handDistance, delta });
+    } else if (sample.arrowKnocked) {
+        history.Push({ 0.0f, sample.drawAmount, sample.handDistance, delta });
+    } else {
+        // No arrow on the string, so no rest pose to carry into the next draw
+        history.Clear();
+    }
+
+    auto* handler = PenetratingArrowHandler::GetSingleton();
+    switch (edge) {
+    case DrawDetector::Edge::Started:
+        drawStartTime = GameClock::GetSingleton()->RealNow();
+        SKSE::log::info("BowDrawTracker: Draw started (amount {:.2f}, hands {:.1f})", sample.drawAmount, sample.handDistance);
+        EventRecorder::GetSingleton()->RecordDraw(EventLog::Type::DrawStart);
+        handler->OnBowDrawStart();
+        break;
+    case DrawDetector::Edge::Stopped:
+        SKSE::log::info("BowDrawTracker: Draw stopped after {}ms",
+                        std::chrono::duration_cast<std::chrono::milliseconds>(GameClock::GetSingleton()->RealNow() - drawStartTime).count());
+        LogHistory();
+        EventRecorder::GetSingleton()->RecordDraw(EventLog::Type::DrawStop);
+        handler->OnBowDrawStop();
+        break;
+    default:
+        break;
+    }
+
+    if (detector.IsDrawing()) {
+        EventRecorder::GetSingleton()->RecordDraw(EventLog::Type::DrawFrame, drawStrength);
+        handler->OnDrawFrame(drawStrength, delta);
+    }
+}
+
+void BowDrawTracker::LogHistory() const
+{
+    SKSE::log::info("BowDrawTracker: Last {} frames - mean strength {:.2f}, peak {:.2f}, rest distance {:.1f}",
+                    history.Size(), history.MeanStrength(), history.PeakStrength(), restDistance);
+
+    // Per-frame trail for tuning fFullDrawDistance; fixed buffer, no allocation
+    std::array<char, kHistoryFrames * 5 + 1> trail{};
+    std::size_t length = 0;
+    history.ForEach([&](const DrawDetector::HistoryEntry& entry) {
+        auto result = std::format_to_n(trail.data() + length, trail.size() - 1 - length, "{:.2f} ", entry.strength);
+        length = std::min(length + static_cast<std::size_t>(result.size), trail.size() - 1);
+    });
+    SKSE::log::debug("BowDrawTracker: Strength trail {}", std::string_view(trail.data(), length));
+}
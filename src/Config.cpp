@@ -1,4 +1,5 @@
 #include "Config.h"
+#include "Trace.h"
 #include <RE/Skyrim.h>
 #include <SKSE/SKSE.h>
 #include <SimpleIni.h>
@@ -14,6 +15,7 @@ Config* Config::GetSingleton() {
 }
 
 void Config::LoadFromINI() {
+    Trace::Zone zone("Config::LoadFromINI");
     CSimpleIniA ini;
     ini.SetUnicode();
 
@@ -26,31 +28,47 @@ void Config::LoadFromINI() {
 
     // General Settings
     enablePerks = ini.GetBoolValue("General", "bEnablePerks", enablePerks);
+    notificationInterval = static_cast<float>(ini.GetDoubleValue("General", "fNotificationInterval", notificationInterval));
+    recordEvents = ini.GetBoolValue("Debug", "bRecordEvents", recordEvents);
+    metricsLogInterval = static_cast<float>(ini.GetDoubleValue("Debug", "fMetricsLogInterval", metricsLogInterval));
+    traceZones = ini.GetBoolValue("Debug", "bTraceZones", traceZones);
     
     // Multishot Settings
     multishot.enabled = ini.GetBoolValue("Multishot", "bEnabled", multishot.enabled);
     multishot.arrowCount = static_cast<int>(ini.GetLongValue("Multishot", "iArrowCount", multishot.arrowCount));
     multishot.spreadAngle = static_cast<float>(ini.GetDoubleValue("Multishot", "fSpreadAngle", multishot.spreadAngle));
+    const char* spreadPattern = ini.GetValue("Multishot", "sSpreadPattern", nullptr);
+    if (spreadPattern) {
+        auto pattern = SpreadPatterns::FromString(spreadPattern, SpreadPatterns::Pattern::kTotal);
+        if (pattern == SpreadPatterns::Pattern::kTotal) {
+            SKSE::log::warn("Spread pattern '{}' is not recognised, using {}", spreadPattern, SpreadPatterns::ToString(multishot.spreadPattern));
+        } else {
+            multishot.spreadPattern = pattern;
+        }
+    }
     multishot.keyCode = static_cast<int>(ini.GetLongValue("Multishot", "iKeyCode", multishot.keyCode));
     multishot.readyWindowDuration = static_cast<float>(ini.GetDoubleValue("Multishot", "fReadyWindowDuration", multishot.readyWindowDuration));
     multishot.cooldownDuration = static_cast<float>(ini.GetDoubleValue("Multishot", "fCooldownDuration", multishot.cooldownDuration));
+    multishot.convergence = ini.GetBoolValue("Multishot", "bConvergence", multishot.convergence);
+    multishot.convergenceDistance = static_cast<float>(ini.GetDoubleValue("Multishot", "fConvergenceDistance", multishot.convergenceDistance));
+    multishot.convergenceSpacing = static_cast<float>(ini.GetDoubleValue("Multishot", "fConvergenceSpacing", multishot.convergenceSpacing));
     
     // Validate configuration values
     if (multishot.arrowCount < 2) {
         SKSE::log::warn("Arrow count {} is too low, setting to minimum of 2", multishot.arrowCount);
         multishot.arrowCount = 2;
     }
-    if (multishot.arrowCount > 10) {
-        SKSE::log::warn("Arrow count {} is too high, setting to maximum of 10", multishot.arrowCount);
-        multishot.arrowCount = 10;
+    if (multishot.arrowCount > SpreadPatterns::kMaxArrows) {
+        SKSE::log::warn("Arrow count {} is too high, setting to maximum of {}", multishot.arrowCount, SpreadPatterns::kMaxArrows);
+        multishot.arrowCount = SpreadPatterns::kMaxArrows;
     }
     if (multishot.spreadAngle < 0.0f) {
         SKSE::log::warn("Spread angle {} is negative, setting to 0", multishot.spreadAngle);
         multishot.spreadAngle = 0.0f;
     }
-    if (multishot.spreadAngle > 90.0f) {
-        SKSE::log::warn("Spread angle {} is too wide, setting to maximum of 90", multishot.spreadAngle);
-        multishot.spreadAngle = 90.0f;
+    if (multishot.spreadAngle > 45.0f) {
+        SKSE::log::warn("Spread angle {} is too wide, setting to maximum of 45", multishot.spreadAngle);
+        multishot.spreadAngle = 45.0f;
     }
     if (multishot.readyWindowDuration < 1.0f) {
         SKSE::log::warn("Ready window duration {} is too short, setting to minimum of 1 second", multishot.readyWindowDuration);
@@ -68,6 +86,18 @@ void Config::LoadFromINI() {
         SKSE::log::warn("Cooldown duration {} is too long, setting to maximum of 300 seconds", multishot.cooldownDuration);
         multishot.cooldownDuration = 300.0f;
     }
+    if (multishot.convergenceDistance < 256.0f) {
+        SKSE::log::warn("Convergence distance {} is too short, setting to minimum of 256 units", multishot.convergenceDistance);
+        multishot.convergenceDistance = 256.0f;
+    }
+    if (multishot.convergenceDistance > 16384.0f) {
+        SKSE::log::warn("Convergence distance {} is too long, setting to maximum of 16384 units", multishot.convergenceDistance);
+        multishot.convergenceDistance = 16384.0f;
+    }
+    if (multishot.convergenceSpacing < 0.0f) {
+        SKSE::log::warn("Convergence spacing {} is negative, setting to 0", multishot.convergenceSpacing);
+        multishot.convergenceSpacing = 0.0f;
+    }
     
     // Penetrating Arrow Settings
     penetratingArrow.enabled = ini.GetBoolValue("PenetratingArrow", "bEnabled", penetratingArrow.enabled);
@@ -75,6 +105,9 @@ void Config::LoadFromINI() {
     penetratingArrow.cooldownDuration = static_cast<float>(ini.GetDoubleValue("PenetratingArrow", "fCooldownDuration", penetratingArrow.cooldownDuration));
     penetratingArrow.damageMultiplier = static_cast<float>(ini.GetDoubleValue("PenetratingArrow", "fDamageMultiplier", penetratingArrow.damageMultiplier));
     penetratingArrow.speedMultiplier = static_cast<float>(ini.GetDoubleValue("PenetratingArrow", "fSpeedMultiplier", penetratingArrow.speedMultiplier));
+    penetratingArrow.maxTargets = static_cast<int>(ini.GetLongValue("PenetratingArrow", "iMaxTargets", penetratingArrow.maxTargets));
+    penetratingArrow.damageFalloff = static_cast<float>(ini.GetDoubleValue("PenetratingArrow", "fDamageFalloff", penetratingArrow.damageFalloff));
+    penetratingArrow.fullDrawDistance = static_cast<float>(ini.GetDoubleValue("PenetratingArrow", "fFullDrawDistance", penetratingArrow.fullDrawDistance));
     
     // Validate penetrating arrow configuration values
     if (penetratingArrow.chargeTime < 1.0f) {
@@ -94,15 +127,48 @@ void Config::LoadFromINI() {
         SKSE::log::warn("Penetrating arrow cooldown duration {} is too long, setting to maximum of 300 seconds", penetratingArrow.cooldownDuration);
         penetratingArrow.cooldownDuration = 300.0f;
     }
+    if (penetratingArrow.maxTargets < 1) {
+        SKSE::log::warn("Penetrating arrow max targets {} is too low, setting to minimum of 1", penetratingArrow.maxTargets);
+        penetratingArrow.maxTargets = 1;
+    }
+    if (penetratingArrow.maxTargets > 8) {
+        SKSE::log::warn("Penetrating arrow max targets {} is too high, setting to maximum of 8", penetratingArrow.maxTargets);
+        penetratingArrow.maxTargets = 8;
+    }
+    if (penetratingArrow.damageFalloff < 0.0f || penetratingArrow.damageFalloff > 1.0f) {
+        SKSE::log::warn("Penetrating arrow damage falloff {} is outside 0-1, setting to 0.75", penetratingArrow.damageFalloff);
+        penetratingArrow.damageFalloff = 0.75f;
+    }
+    if (penetratingArrow.fullDrawDistance < 10.0f) {
+        SKSE::log::warn("Penetrating arrow full draw distance {} is too short, setting to minimum of 10", penetratingArrow.fullDrawDistance);
+        penetratingArrow.fullDrawDistance = 10.0f;
+    }
+    if (penetratingArrow.fullDrawDistance > 200.0f) {
+        SKSE::log::warn("Penetrating arrow full draw distance {} is too long, setting to maximum of 200", penetratingArrow.fullDrawDistance);
+        penetratingArrow.fullDrawDistance = 200.0f;
+    }
+    
+    if (notificationInterval < 0.0f) {
+        SKSE::log::warn("Notification interval {} is negative, setting to 0", notificationInterval);
+        notificationInterval = 0.0f;
+    }
+    if (metricsLogInterval < 0.0f) {
+        SKSE::log::warn("Metrics log interval {} is negative, disabling the periodic metrics line", metricsLogInterval);
+        metricsLogInterval = 0.0f;
+    }
     
-    SKSE::log::info("General config loaded - Enable Perks: {}", enablePerks);
+    SKSE::log::info("General config loaded - Enable Perks: {}, Notification Interval: {}s, Record Events: {}, Metrics Log Interval: {}s, Trace Zones: {}",
+                    enablePerks, notificationInterval, recordEvents, metricsLogInterval, traceZones);
     
-    SKSE::log::info("Multishot config loaded - Enabled: {}, Arrow Count: {}, Spread Angle: {}, Key Code: {}, Ready Window: {}s, Cooldown: {}s", 
-                    multishot.enabled, multishot.arrowCount, multishot.spreadAngle, multishot.keyCode, 
+    SKSE::log::info("Multishot config loaded - Enabled: {}, Arrow Count: {}, Spread Angle: {}, Spread Pattern: {}, Key Code: {}, Ready Window: {}s, Cooldown: {}s", 
+                    multishot.enabled, multishot.arrowCount, multishot.spreadAngle, SpreadPatterns::ToString(multishot.spreadPattern), multishot.keyCode, 
                     multishot.readyWindowDuration, multishot.cooldownDuration);
+    SKSE::log::info("Multishot convergence - Enabled: {}, Distance: {}, Spacing: {}",
+                    multishot.convergence, multishot.convergenceDistance, multishot.convergenceSpacing);
     
-    SKSE::log::info("Penetrating Arrow config loaded - Enabled: {}, Charge Time: {}s, Cooldown: {}s", 
-                    penetratingArrow.enabled, penetratingArrow.chargeTime, penetratingArrow.cooldownDuration);
+    SKSE::log::info("Penetrating Arrow config loaded - Enabled: {}, Charge Time: {}s, Cooldown: {}s, Max Targets: {}, Damage Falloff: {}, Full Draw Distance: {}", 
+                    penetratingArrow.enabled, penetratingArrow.chargeTime, penetratingArrow.cooldownDuration,
+                    penetratingArrow.maxTargets, penetratingArrow.damageFalloff, penetratingArrow.fullDrawDistance);
 }
 
 bool Config::HasMultishotPerk() {
@@ -0,0 +1,66 @@
+#include "ConsoleCommands.h"
+#include "Metrics.h"
+#include "TaskQueue.h"
+#include "Trace.h"
+
+namespace ConsoleCommands {
+    namespace {
+        // Leftover developer command with no effect in the shipped game
+        constexpr std::string_view kReplacedCommand = "TestSeenData";
+
+        bool ArcheryStats(const RE::SCRIPT_PARAMETER*, RE::SCRIPT_FUNCTION::ScriptData*, RE::TESObjectREFR*, RE::TESObjectREFR*, RE::Script*,
+                          RE::ScriptLocals*, double&, std::uint32_t&)
+        {
+            auto* console = RE::ConsoleLog::GetSingleton();
+            if (!console) {
+                return true;
+            }
+
+            console->Print("ArcheryTechniques metrics (latencies in microseconds):");
+            for (const auto& line : Metrics::GetSingleton()->FormatReport()) {
+                console->Print("  %s", line.c_str());
+            }
+            auto* tasks = TaskQueue::GetSingleton();
+            console->Print("  taskQueue depth=%zu peak=%zu capacity=%zu", tasks->Depth(), tasks->PeakDepth(), TaskQueue::kCapacity);
+            if (Trace::IsEnabled()) {
+                ExportTrace();
+                console->Print("  Profiling zones written to ArcheryTechniques.trace.json in the SKSE log folder");
+            }
+            return true;
+        }
+    }
+
+    void ExportTrace()
+    {
+        auto logsFolder = SKSE::log::log_directory();
+        if (!logsFolder) {
+            return;
+        }
+
+        auto path = *logsFolder / "ArcheryTechniques.trace.json";
+        auto written = Trace::Export(path);
+        if (written < 0) {
+            SKSE::log::error("ConsoleCommands: Could not write {}", path.string());
+        } else {
+            SKSE::log::info("ConsoleCommands: Wrote {} profiling events to {}", written, path.string());
+        }
+    }
+
+    void Install()
+    {
+        auto* command = RE::SCRIPT_FUNCTION::LocateConsoleCommand(kReplacedCommand);
+        if (!command) {
+            SKSE::log::warn("ConsoleCommands: {} not found, ArcheryStats is unavailable", kReplacedCommand);
+            return;
+        }
+
+        command->functionName = "ArcheryStats";
+        command->shortName = "";
+        command->helpString = "Print ArcheryTechniques latency histograms and counters";
+        command->referenceFunction = false;
+        command->numParams = 0;
+        command->params = nullptr;
+        command->executeFunction = ArcheryStats;
+        SKSE::log::info("ConsoleCommands: ArcheryStats registered");
+    }
+}
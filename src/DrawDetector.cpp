@@ -0,0 +1,40 @@
+#include "DrawDetector.h"
+#include <algorithm>
+
+namespace DrawDetector {
+    Edge Detector::Step(const Sample& sample)
+    {
+        if (!drawing) {
+            if (sample.arrowKnocked && sample.drawAmount >= kStartThreshold) {
+                drawing = true;
+                return Edge::Started;
+            }
+            return Edge::None;
+        }
+
+        // Losing the arrow (fired, unknocked, out of ammo) ends the draw immediately
+        if (!sample.arrowKnocked || sample.drawAmount <= kStopThreshold) {
+            drawing = false;
+            return Edge::Stopped;
+        }
+        return Edge::None;
+    }
+
+    float ComputeStrength(float handDistance, float restDistance, float fullDrawDistance)
+    {
+        if (fullDrawDistance <= 0.0f) {
+            return 1.0f;
+        }
+        return std::clamp((handDistance - restDistance) / fullDrawDistance, 0.0f, 1.0f);
+    }
+
+    float ChargeIntegrator::Advance(float strength, float delta, float chargeTime)
+    {
+        if (chargeTime <= 0.0f) {
+            progress = 1.0f;
+            return progress;
+        }
+        progress = std::min(1.0f, progress + std::clamp(strength, 0.0f, 1.0f) * std::max(delta, 0.0f) / chargeTime);
+        return progress;
+    }
+}
@@ -0,0 +1,130 @@
+#include "EventLog.h"
+
+namespace {
+    // Case-insensitive like BSFixedString's comparison. Names are alphabetic, so folding
+    // bit 5 is enough; callers have already matched the length.
+    bool SameText(std::string_view tag, std::string_view name)
+    {
+        for (std::size_t i = 0; i < name.size(); ++i) {
+            if ((tag[i] | 0x20) != (name[i] | 0x20)) {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+EventLog::Tag EventLog::ClassifyTag(std::string_view tag)
+{
+    // Most graph events are footsteps and sounds; the length rules them out before any compare
+    switch (tag.size()) {
+    case 7:
+        return SameText(tag, "bowDraw") ? Tag::BowDraw : Tag::Other;
+    case 9:
+        return SameText(tag, "bowUnDraw") ? Tag::BowDrawStop : Tag::Other;
+    case 10:
+        return SameText(tag, "bowRelease") ? Tag::BowDrawStop : Tag::Other;
+    case 11:
+        return SameText(tag, "bowDrawStop") || SameText(tag, "weaponSwing") ? Tag::BowDrawStop : Tag::Other;
+    case 12:
+        if (SameText(tag, "arrowRelease")) {
+            return Tag::ArrowRelease;
+        }
+        return SameText(tag, "bowDrawStart") ? Tag::BowDraw : Tag::Other;
+    case 15:
+        return SameText(tag, "weaponLeftSwing") ? Tag::BowDrawStop : Tag::Other;
+    default:
+        return Tag::Other;
+    }
+}
+
+EventLog::Writer::~Writer()
+{
+    Close();
+}
+
+bool EventLog::Writer::Open(const std::filesystem::path& path, const Header& header)
+{
+    Close();
+
+#ifdef _WIN32
+    file = _wfopen(path.c_str(), L"wb");
+#else
+    file = std::fopen(path.c_str(), "wb");
+#endif
+    if (!file) {
+        return false;
+    }
+
+    Header stamped = header;
+    stamped.magic = kMagic;
+    stamped.version = kVersion;
+    stamped.recordSize = sizeof(Record);
+    std::fwrite(&stamped, sizeof(stamped), 1, file);
+
+    buffer.reserve(kBufferRecords);
+    count = 0;
+    return true;
+}
+
+void EventLog::Writer::Append(const Record& record)
+{
+    if (!file) {
+        return;
+    }
+    buffer.push_back(record);
+    ++count;
+    if (buffer.size() == kBufferRecords) {
+        Flush();
+    }
+}
+
+void EventLog::Writer::Flush()
+{
+    if (!file) {
+        return;
+    }
+    if (!buffer.empty()) {
+        std::fwrite(buffer.data(), sizeof(Record), buffer.size(), file);
+        buffer.clear();
+    }
+    std::fflush(file);
+}
+
+void EventLog::Writer::Close()
+{
+    if (!file) {
+        return;
+    }
+    Flush();
+    std::fclose(file);
+    file = nullptr;
+}
+
+bool EventLog::Read(const std::filesystem::path& path, Header& header, std::vector<Record>& records)
+{
+    records.clear();
+
+#ifdef _WIN32
+    std::FILE* file = _wfopen(path.c_str(), L"rb");
+#else
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+#endif
+    if (!file) {
+        return false;
+    }
+
+    bool valid = std::fread(&header, sizeof(header), 1, file) == 1 && header.magic == kMagic && header.version == kVersion &&
+                 header.recordSize == sizeof(Record);
+    if (valid) {
+        std::error_code error;
+        auto size = std::filesystem::file_size(path, error);
+        if (!error && size > sizeof(Header)) {
+            records.resize((size - sizeof(Header)) / sizeof(Record));
+            records.resize(std::fread(records.data(), sizeof(Record), records.size(), file));
+        }
+    }
+
+    std::fclose(file);
+    return valid;
+}
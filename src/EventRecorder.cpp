@@ -0,0 +1,151 @@
+#include "EventRecorder.h"
+#include "Config.h"
+#include "MultishotHandler.h"
+#include "PenetratingArrowHandler.h"
+#include "SkyrimFacade.h"
+
+EventRecorder* EventRecorder::GetSingleton()
+{
+    static EventRecorder singleton;
+    return &singleton;
+}
+
+void EventRecorder::Start()
+{
+    auto* config = Config::GetSingleton();
+    if (!config->recordEvents || IsRecording()) {
+        return;
+    }
+
+    auto logsFolder = SKSE::log::log_directory();
+    if (!logsFolder) {
+        SKSE::log::warn("EventRecorder: No log directory, events will not be recorded");
+        return;
+    }
+
+    EventLog::Header header;
+    header.multishot = config->multishot;
+    header.penetratingArrow = config->penetratingArrow;
+    header.enablePerks = config->enablePerks;
+
+    auto path = *logsFolder / "ArcheryTechniques.events";
+    std::scoped_lock guard(lock);
+    if (writer.IsOpen()) {
+        return;
+    }
+    if (writer.Open(path, header)) {
+        recording.store(true, std::memory_order_relaxed);
+        SKSE::log::info("EventRecorder: Recording technique events to {}", path.string());
+    } else {
+        SKSE::log::error("EventRecorder: Could not open {}", path.string());
+    }
+}
+
+void EventRecorder::Append(const EventLog::Record& record)
+{
+    std::scoped_lock guard(lock);
+    writer.Append(record);
+}
+
+void EventRecorder::RecordFrame(float gameDelta)
+{
+    if (!IsRecording()) {
+        return;
+    }
+
+    auto* game = SkyrimFacade::GetSingleton();
+    auto shooter = game->GetShooter();
+
+    std::uint16_t facts = 0;
+    facts |= shooter.present ? EventLog::kPresent : 0;
+    facts |= shooter.incapacitated ? EventLog::kIncapacitated : 0;
+    facts |= shooter.paused ? EventLog::kPaused : 0;
+    facts |= shooter.hasBow ? EventLog::kHasBow : 0;
+    facts |= shooter.hasAmmo ? EventLog::kHasAmmo : 0;
+    facts |= game->MeetsPerkRequirement(Game::Technique::Multishot) ? EventLog::kMultishotPerk : 0;
+    facts |= game->MeetsPerkRequirement(Game::Technique::PenetratingArrow) ? EventLog::kPenetratingPerk : 0;
+    facts |= game->IsDrawTracked() ? EventLog::kDrawTracked : 0;
+    facts |= game->IsDrawing() ? EventLog::kDrawing : 0;
+
+    EventLog::Record record;
+    record.type = EventLog::Type::Frame;
+    record.flags = facts;
+    record.value = gameDelta;
+    Append(record);
+
+    if (++frames % kFlushFrames == 0) {
+        std::scoped_lock guard(lock);
+        writer.Flush();
+    }
+}
+
+void EventRecorder::RecordUpdate()
+{
+    if (!IsRecording()) {
+        return;
+    }
+
+    EventLog::Record record;
+    record.type = EventLog::Type::Update;
+    Append(record);
+}
+
+void EventRecorder::RecordKeyPress(std::uint32_t keyCode)
+{
+    if (!IsRecording()) {
+        return;
+    }
+
+    EventLog::Record record;
+    record.type = EventLog::Type::KeyPress;
+    record.data = keyCode;
+    Append(record);
+}
+
+void EventRecorder::RecordAnimTag(Game::Technique receiver, EventLog::Tag tag)
+{
+    if (!IsRecording() || tag == EventLog::Tag::Other) {
+        return;
+    }
+
+    EventLog::Record record;
+    record.type = EventLog::Type::AnimTag;
+    record.flags = static_cast<std::uint16_t>(receiver);
+    record.data = static_cast<std::uint32_t>(tag);
+    if (receiver == Game::Technique::Multishot && tag == EventLog::Tag::ArrowRelease) {
+        // The volley's ammo check is the only read of the inventory
+        record.value = static_cast<float>(SkyrimFacade::GetSingleton()->AmmoCount());
+    }
+    Append(record);
+}
+
+void EventRecorder::RecordDraw(EventLog::Type type, float strength)
+{
+    if (!IsRecording()) {
+        return;
+    }
+
+    EventLog::Record record;
+    record.type = type;
+    record.value = strength;
+    Append(record);
+}
+
+void EventRecorder::Checkpoint()
+{
+    if (!IsRecording()) {
+        return;
+    }
+
+    auto state = EventLog::PackState(static_cast<std::uint8_t>(MultishotHandler::GetSingleton()->GetCurrentState()),
+                                     static_cast<std::uint8_t>(PenetratingArrowHandler::GetSingleton()->GetCurrentState()));
+    if (state == lastState) {
+        return;
+    }
+    lastState = state;
+
+    EventLog::Record record;
+    record.type = EventLog::Type::State;
+    record.data = state;
+    Append(record);
+}
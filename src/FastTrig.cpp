@@ -0,0 +1,302 @@
+#include "FastTrig.h"
+#include <algorithm>
+#include <cmath>
+
+#if defined(_M_X64) || defined(__SSE2__)
+    #define FASTTRIG_HAS_SSE 1
+    #include <immintrin.h>
+#endif
+
+namespace FastTrig {
+    namespace {
+        // Cody-Waite split of pi/2: the first two parts have few enough bits
+        // that q * part is exact for every quadrant count in kSinCosRange
+        constexpr float kTwoOverPi = 0.636619772f;
+        constexpr float kHalfPiA = 1.5703125f;
+        constexpr float kHalfPiB = 4.837512969970703125e-4f;
+        constexpr float kHalfPiC = 7.54978995489188216e-8f;
+
+        // Minimax polynomials on [-pi/4, pi/4] (Cephes sinf/cosf)
+        constexpr float kSin0 = -1.9515295891e-4f;
+        constexpr float kSin1 = 8.3321608736e-3f;
+        constexpr float kSin2 = -1.6666654611e-1f;
+        constexpr float kCos0 = 2.443315711809948e-5f;
+        constexpr float kCos1 = -1.388731625493765e-3f;
+        constexpr float kCos2 = 4.166664568298827e-2f;
+
+        // Minimax polynomial on [-tan(pi/8), tan(pi/8)] (Cephes atanf)
+        constexpr float kTanPi8 = 0.4142135623730950f;
+        constexpr float kQuarterPi = kPi / 4.0f;
+        // float(pi) overshoots by 8.7e-8; the low parts take that back out of each offset
+        constexpr float kPiLo = -8.742278e-8f;
+        constexpr float kHalfPiLo = kPiLo / 2.0f;
+        constexpr float kQuarterPiLo = kPiLo / 4.0f;
+        constexpr float kAtan0 = 8.05374449538e-2f;
+        constexpr float kAtan1 = -1.38776856032e-1f;
+        constexpr float kAtan2 = 1.99777106478e-1f;
+        constexpr float kAtan3 = -3.33329491539e-1f;
+
+        // atan of a ratio already folded into [0, 1]
+        float AtanUnit(float a)
+        {
+            bool big = a > kTanPi8;
+            float t = big ? (a - 1.0f) / (a + 1.0f) : a;
+            float z = t * t;
+            float p = (((kAtan0 * z + kAtan1) * z + kAtan2) * z + kAtan3) * z * t + t;
+            return big ? (p + kQuarterPiLo) + kQuarterPi : p;
+        }
+
+#ifdef FASTTRIG_HAS_SSE
+        inline __m128 Select(__m128 mask, __m128 a, __m128 b)
+        {
+            return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+        }
+
+        void SinCos4(__m128 x, __m128& sin, __m128& cos)
+        {
+            // cvtps rounds to nearest under the default MXCSR mode
+            __m128i q = _mm_cvtps_epi32(_mm_mul_ps(x, _mm_set1_ps(kTwoOverPi)));
+            __m128 qf = _mm_cvtepi32_ps(q);
+            __m128 r = _mm_sub_ps(x, _mm_mul_ps(qf, _mm_set1_ps(kHalfPiA)));
+            r = _mm_sub_ps(r, _mm_mul_ps(qf, _mm_set1_ps(kHalfPiB)));
+            r = _mm_sub_ps(r, _mm_mul_ps(qf, _mm_set1_ps(kHalfPiC)));
+            __m128 z = _mm_mul_ps(r, r);
+
+            __m128 s = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(kSin0), z), _mm_set1_ps(kSin1));
+            s = _mm_add_ps(_mm_mul_ps(s, z), _mm_set1_ps(kSin2));
+            s = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(s, z), r), r);
+
+            __m128 c = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(kCos0), z), _mm_set1_ps(kCos1));
+            c = _mm_add_ps(_mm_mul_ps(c, z), _mm_set1_ps(kCos2));
+            c = _mm_mul_ps(_mm_mul_ps(c, z), z);
+            c = _mm_add_ps(_mm_sub_ps(c, _mm_mul_ps(_mm_set1_ps(0.5f), z)), _mm_set1_ps(1.0f));
+
+            // Odd quadrants swap sin and cos; bit 1 of q (q + 1 for cos) flips the sign
+            __m128i one = _mm_set1_epi32(1);
+            __m128i two = _mm_set1_epi32(2);
+            __m128 swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(q, one), one));
+            __m128 sinSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(q, two), 30));
+            __m128 cosSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(q, one), two), 30));
+            sin = _mm_xor_ps(Select(swap, c, s), sinSign);
+            cos = _mm_xor_ps(Select(swap, s, c), cosSign);
+        }
+
+        __m128 Atan2x4(__m128 y, __m128 x)
+        {
+            __m128 signMask = _mm_set1_ps(-0.0f);
+            __m128 ax = _mm_andnot_ps(signMask, x);
+            __m128 ay = _mm_andnot_ps(signMask, y);
+            __m128 hi = _mm_max_ps(ax, ay);
+            __m128 a = _mm_and_ps(_mm_cmpgt_ps(hi, _mm_setzero_ps()), _mm_div_ps(_mm_min_ps(ax, ay), hi));
+
+            __m128 one = _mm_set1_ps(1.0f);
+            __m128 big = _mm_cmpgt_ps(a, _mm_set1_ps(kTanPi8));
+            __m128 t = Select(big, _mm_div_ps(_mm_sub_ps(a, one), _mm_add_ps(a, one)), a);
+            __m128 z = _mm_mul_ps(t, t);
+            __m128 p = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(kAtan0), z), _mm_set1_ps(kAtan1));
+            p = _mm_add_ps(_mm_mul_ps(p, z), _mm_set1_ps(kAtan2));
+            p = _mm_add_ps(_mm_mul_ps(p, z), _mm_set1_ps(kAtan3));
+            p = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(p, z), t), t);
+            __m128 r = Select(big, _mm_add_ps(_mm_add_ps(p, _mm_set1_ps(kQuarterPiLo)), _mm_set1_ps(kQuarterPi)), p);
+
+            __m128 steep = _mm_cmpgt_ps(ay, ax);
+            __m128 xNegative = _mm_castsi128_ps(_mm_srai_epi32(_mm_castps_si128(x), 31));
+            __m128 offset = _mm_and_ps(steep, _mm_set1_ps(kHalfPi));
+            __m128 offsetLo = _mm_and_ps(steep, _mm_set1_ps(kHalfPiLo));
+            offset = Select(xNegative, _mm_sub_ps(_mm_set1_ps(kPi), offset), offset);
+            offsetLo = Select(xNegative, _mm_sub_ps(_mm_set1_ps(kPiLo), offsetLo), offsetLo);
+            r = _mm_xor_ps(r, _mm_and_ps(_mm_xor_ps(steep, xNegative), signMask));
+            r = _mm_add_ps(offset, _mm_add_ps(r, offsetLo));
+            return _mm_or_ps(r, _mm_and_ps(y, signMask));
+        }
+#endif
+
+#ifdef __AVX__
+        void SinCos8(__m256 x, __m256& sin, __m256& cos)
+        {
+            // Quadrant bits are taken in float arithmetic; 256-bit integer ops need AVX2
+            __m256 qf = _mm256_round_ps(_mm256_mul_ps(x, _mm256_set1_ps(kTwoOverPi)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+            __m256 r = _mm256_sub_ps(x, _mm256_mul_ps(qf, _mm256_set1_ps(kHalfPiA)));
+            r = _mm256_sub_ps(r, _mm256_mul_ps(qf, _mm256_set1_ps(kHalfPiB)));
+            r = _mm256_sub_ps(r, _mm256_mul_ps(qf, _mm256_set1_ps(kHalfPiC)));
+            __m256 z = _mm256_mul_ps(r, r);
+
+            __m256 s = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(kSin0), z), _mm256_set1_ps(kSin1));
+            s = _mm256_add_ps(_mm256_mul_ps(s, z), _mm256_set1_ps(kSin2));
+            s = _mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(s, z), r), r);
+
+            __m256 c = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(kCos0), z), _mm256_set1_ps(kCos1));
+            c = _mm256_add_ps(_mm256_mul_ps(c, z), _mm256_set1_ps(kCos2));
+            c = _mm256_mul_ps(_mm256_mul_ps(c, z), z);
+            c = _mm256_add_ps(_mm256_sub_ps(c, _mm256_mul_ps(_mm256_set1_ps(0.5f), z)), _mm256_set1_ps(1.0f));
+
+            // quadrant = q mod 4, in [0, 3]
+            __m256 four = _mm256_set1_ps(4.0f);
+            __m256 quadrant = _mm256_sub_ps(qf, _mm256_mul_ps(four, _mm256_floor_ps(_mm256_mul_ps(qf, _mm256_set1_ps(0.25f)))));
+            __m256 one = _mm256_set1_ps(1.0f);
+            __m256 isOne = _mm256_cmp_ps(quadrant, one, _CMP_EQ_OQ);
+            __m256 isTwo = _mm256_cmp_ps(quadrant, _mm256_set1_ps(2.0f), _CMP_EQ_OQ);
+            __m256 isThree = _mm256_cmp_ps(quadrant, _mm256_set1_ps(3.0f), _CMP_EQ_OQ);
+            __m256 signMask = _mm256_set1_ps(-0.0f);
+            __m256 swap = _mm256_or_ps(isOne, isThree);
+            __m256 sinSign = _mm256_and_ps(_mm256_or_ps(isTwo, isThree), signMask);
+            __m256 cosSign = _mm256_and_ps(_mm256_or_ps(isOne, isTwo), signMask);
+            sin = _mm256_xor_ps(_mm256_blendv_ps(s, c, swap), sinSign);
+            cos = _mm256_xor_ps(_mm256_blendv_ps(c, s, swap), cosSign);
+        }
+
+        __m256 Atan2x8(__m256 y, __m256 x)
+        {
+            __m256 signMask = _mm256_set1_ps(-0.0f);
+            __m256 ax = _mm256_andnot_ps(signMask, x);
+            __m256 ay = _mm256_andnot_ps(signMask, y);
+            __m256 hi = _mm256_max_ps(ax, ay);
+            __m256 a = _mm256_and_ps(_mm256_cmp_ps(hi, _mm256_setzero_ps(), _CMP_GT_OQ), _mm256_div_ps(_mm256_min_ps(ax, ay), hi));
+
+            __m256 one = _mm256_set1_ps(1.0f);
+            __m256 big = _mm256_cmp_ps(a, _mm256_set1_ps(kTanPi8), _CMP_GT_OQ);
+            __m256 t = _mm256_blendv_ps(a, _mm256_div_ps(_mm256_sub_ps(a, one), _mm256_add_ps(a, one)), big);
+            __m256 z = _mm256_mul_ps(t, t);
+            __m256 p = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(kAtan0), z), _mm256_set1_ps(kAtan1));
+            p = _mm256_add_ps(_mm256_mul_ps(p, z), _mm256_set1_ps(kAtan2));
+            p = _mm256_add_ps(_mm256_mul_ps(p, z), _mm256_set1_ps(kAtan3));
+            p = _mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(p, z), t), t);
+            __m256 r = _mm256_blendv_ps(p, _mm256_add_ps(_mm256_add_ps(p, _mm256_set1_ps(kQuarterPiLo)), _mm256_set1_ps(kQuarterPi)), big);
+
+            __m256 steep = _mm256_cmp_ps(ay, ax, _CMP_GT_OQ);
+            __m256 offset = _mm256_and_ps(steep, _mm256_set1_ps(kHalfPi));
+            __m256 offsetLo = _mm256_and_ps(steep, _mm256_set1_ps(kHalfPiLo));
+            // blendv keys on the sign bit, so x itself is the mask (and -0 counts as negative)
+            offset = _mm256_blendv_ps(offset, _mm256_sub_ps(_mm256_set1_ps(kPi), offset), x);
+            offsetLo = _mm256_blendv_ps(offsetLo, _mm256_sub_ps(_mm256_set1_ps(kPiLo), offsetLo), x);
+            r = _mm256_xor_ps(r, _mm256_and_ps(_mm256_xor_ps(steep, x), signMask));
+            r = _mm256_add_ps(offset, _mm256_add_ps(r, offsetLo));
+            return _mm256_or_ps(r, _mm256_and_ps(y, signMask));
+        }
+#endif
+    }
+
+    void SinCos(float x, float& sin, float& cos)
+    {
+        float scaled = x * kTwoOverPi;
+        int q = static_cast<int>(scaled >= 0.0f ? scaled + 0.5f : scaled - 0.5f);
+        float qf = static_cast<float>(q);
+        float r = x - qf * kHalfPiA;
+        r = r - qf * kHalfPiB;
+        r = r - qf * kHalfPiC;
+        float z = r * r;
+
+        float s = ((kSin0 * z + kSin1) * z + kSin2) * z * r + r;
+        float c = ((kCos0 * z + kCos1) * z + kCos2) * z * z - 0.5f * z + 1.0f;
+
+        if (q & 1) {
+            std::swap(s, c);
+        }
+        sin = (q & 2) ? -s : s;
+        cos = ((q + 1) & 2) ? -c : c;
+    }
+
+    float Sin(float x)
+    {
+        float sin, cos;
+        SinCos(x, sin, cos);
+        return sin;
+    }
+
+    float Cos(float x)
+    {
+        float sin, cos;
+        SinCos(x, sin, cos);
+        return cos;
+    }
+
+    float Atan2(float y, float x)
+    {
+        float ax = std::fabs(x);
+        float ay = std::fabs(y);
+        float hi = std::max(ax, ay);
+        float r = AtanUnit(hi > 0.0f ? std::min(ax, ay) / hi : 0.0f);
+
+        // Fold the reflections (pi/2 - r when |y| > |x|, pi - r when x < 0) into a
+        // single offset so the result is rounded once
+        float offset = 0.0f;
+        float offsetLo = 0.0f;
+        if (ay > ax) {
+            r = -r;
+            offset = kHalfPi;
+            offsetLo = kHalfPiLo;
+        }
+        if (std::signbit(x)) {
+            r = -r;
+            offset = kPi - offset;
+            offsetLo = kPiLo - offsetLo;
+        }
+        r = offset + (r + offsetLo);
+        return std::copysign(r, y);
+    }
+
+    float Atan(float x)
+    {
+        return Atan2(x, 1.0f);
+    }
+
+    void SinCos(const float* x, float* sin, float* cos, std::size_t count)
+    {
+        std::size_t i = 0;
+#ifdef __AVX__
+        for (; i + 8 <= count; i += 8) {
+            __m256 s, c;
+            SinCos8(_mm256_loadu_ps(x + i), s, c);
+            _mm256_storeu_ps(sin + i, s);
+            _mm256_storeu_ps(cos + i, c);
+        }
+#endif
+#ifdef FASTTRIG_HAS_SSE
+        for (; i + 4 <= count; i += 4) {
+            __m128 s, c;
+            SinCos4(_mm_loadu_ps(x + i), s, c);
+            _mm_storeu_ps(sin + i, s);
+            _mm_storeu_ps(cos + i, c);
+        }
+#endif
+        for (; i < count; ++i) {
+            SinCos(x[i], sin[i], cos[i]);
+        }
+    }
+
+    void Atan(const float* x, float* out, std::size_t count)
+    {
+        std::size_t i = 0;
+#ifdef __AVX__
+        for (; i + 8 <= count; i += 8) {
+            _mm256_storeu_ps(out + i, Atan2x8(_mm256_loadu_ps(x + i), _mm256_set1_ps(1.0f)));
+        }
+#endif
+#ifdef FASTTRIG_HAS_SSE
+        for (; i + 4 <= count; i += 4) {
+            _mm_storeu_ps(out + i, Atan2x4(_mm_loadu_ps(x + i), _mm_set1_ps(1.0f)));
+        }
+#endif
+        for (; i < count; ++i) {
+            out[i] = Atan(x[i]);
+        }
+    }
+
+    void Atan2(const float* y, const float* x, float* out, std::size_t count)
+    {
+        std::size_t i = 0;
+#ifdef __AVX__
+        for (; i + 8 <= count; i += 8) {
+            _mm256_storeu_ps(out + i, Atan2x8(_mm256_loadu_ps(y + i), _mm256_loadu_ps(x + i)));
+        }
+#endif
+#ifdef FASTTRIG_HAS_SSE
+        for (; i + 4 <= count; i += 4) {
+            _mm_storeu_ps(out + i, Atan2x4(_mm_loadu_ps(y + i), _mm_loadu_ps(x + i)));
+        }
+#endif
+        for (; i < count; ++i) {
+            out[i] = Atan2(y[i], x[i]);
+        }
+    }
+}
@@ -0,0 +1,109 @@
+#include "FrameHook.h"
+#include "ArcheryContext.h"
+#include "BowDrawTracker.h"
+#include "Config.h"
+#include "EventRecorder.h"
+#include "GameClock.h"
+#include "Metrics.h"
+#include "MultishotHandler.h"
+#include "NotificationQueue.h"
+#include "PenetratingArrowHandler.h"
+#include "PenetrationEngine.h"
+#include "TaskQueue.h"
+#include "Trace.h"
+#include <chrono>
+
+namespace FrameHook {
+    namespace {
+        // Shows this frame's due notifications with a single UI task
+        void PostNotifications(GameClock::RealTime now)
+        {
+            auto batch = NotificationQueue::GetSingleton()->TakeDue(now, Config::GetSingleton()->notificationInterval);
+            if (batch.count == 0) {
+                return;
+            }
+            auto* taskInterface = SKSE::GetTaskInterface();
+            if (!taskInterface) {
+                return;
+            }
+            taskInterface->AddUITask([batch]() {
+                for (std::size_t i = 0; i < batch.count; ++i) {
+                    RE::DebugNotification(batch.messages[i].data());
+                }
+            });
+        }
+
+        void Update(RE::PlayerCharacter* a_this, float a_delta);
+        REL::Relocation<decltype(Update)> _Update;
+
+        GameClock::RealTime lastMetricsLog{};
+
+        // One summary line every fMetricsLogInterval seconds of real time
+        void LogMetrics(GameClock::RealTime now)
+        {
+            float interval = Config::GetSingleton()->metricsLogInterval;
+            if (interval <= 0.0f) {
+                return;
+            }
+            if (lastMetricsLog == GameClock::RealTime{}) {
+                lastMetricsLog = now;
+                return;
+            }
+            if (now - lastMetricsLog < std::chrono::duration<float>(interval)) {
+                return;
+            }
+            lastMetricsLog = now;
+            SKSE::log::info("Metrics: {}", Metrics::GetSingleton()->FormatLine());
+        }
+
+        void Update(RE::PlayerCharacter* a_this, float a_delta)
+        {
+            // Work deferred during the previous frame runs before this one starts,
+            // after everything that frame did (the vanilla arrow launch included)
+            TaskQueue::GetSingleton()->Drain();
+
+            _Update(a_this, a_delta);
+
+            auto* clock = GameClock::GetSingleton();
+            Trace::Instant("Frame");
+            {
+                Metrics::ScopedTimer frameTimer(Metrics::Stage::Frame);
+                Trace::Zone zone("FrameHook::Update");
+
+                auto* ui = RE::UI::GetSingleton();
+                clock->Tick(std::chrono::steady_clock::now(), a_delta, ui && ui->GameIsPaused());
+                ArcheryContextService::GetSingleton()->Rebuild();
+
+                // Both technique sinks follow the player's graph across rebuilds
+                auto* config = Config::GetSingleton();
+                if (config->multishot.enabled) {
+                    MultishotHandler::GetSingleton()->RefreshAnimationSink();
+                }
+                if (config->penetratingArrow.enabled) {
+                    PenetratingArrowHandler::GetSingleton()->RefreshAnimationSink();
+                }
+
+                auto* recorder = EventRecorder::GetSingleton();
+                recorder->RecordFrame(clock->GameDelta());
+
+                if (config->penetratingArrow.enabled) {
+                    BowDrawTracker::GetSingleton()->Sample(a_this, clock->GameDelta());
+                    PenetratingArrowHandler::GetSingleton()->Update();
+                }
+                PenetrationEngine::GetSingleton()->ReclaimDead();
+
+                recorder->Checkpoint();
+            }
+
+            PostNotifications(clock->RealNow());
+            LogMetrics(clock->RealNow());
+        }
+    }
+
+    void Install()
+    {
+        REL::Relocation<std::uintptr_t> vtbl{ RE::VTABLE_PlayerCharacter[0] };
+        _Update = vtbl.write_vfunc(REL::Relocate<std::size_t>(0xAD, 0xAD, 0xAF), Update);
+        SKSE::log::info("FrameHook: PlayerCharacter::Update hook installed");
+    }
+}
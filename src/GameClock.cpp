@@ -0,0 +1,19 @@
+#include "GameClock.h"
+#include <algorithm>
+
+GameClock* GameClock::GetSingleton()
+{
+    static GameClock singleton;
+    return &singleton;
+}
+
+void GameClock::Tick(RealTime now, float delta, bool isPaused)
+{
+    realDelta = frameNumber > 0 ? std::chrono::duration<float>(now - realNow).count() : 0.0f;
+    realNow = now;
+    ++frameNumber;
+
+    paused = isPaused;
+    gameDelta = paused ? 0.0f : std::clamp(delta, 0.0f, kMaxDelta);
+    gameTime += gameDelta;
+}
@@ -0,0 +1,224 @@
+#include "Metrics.h"
+#include <algorithm>
+#include <bit>
+#include <cstdio>
+
+namespace {
+    // Nanoseconds as microseconds with one decimal
+    void AppendMicros(std::string& out, std::uint64_t nanoseconds)
+    {
+        char text[32];
+        std::snprintf(text, sizeof(text), "%.1fus", static_cast<double>(nanoseconds) / 1000.0);
+        out += text;
+    }
+
+    void AppendStage(std::string& out, const char* name, const LatencyHistogram::Summary& summary)
+    {
+        char text[64];
+        std::snprintf(text, sizeof(text), "%s n=%llu", name, static_cast<unsigned long long>(summary.count));
+        out += text;
+        if (summary.count == 0) {
+            return;
+        }
+        out += " p50=";
+        AppendMicros(out, summary.p50);
+        out += " p90=";
+        AppendMicros(out, summary.p90);
+        out += " p99=";
+        AppendMicros(out, summary.p99);
+        out += " max=";
+        AppendMicros(out, summary.max);
+    }
+}
+
+int LatencyHistogram::BucketIndex(std::uint64_t value)
+{
+    if (value < kSubBuckets) {
+        return static_cast<int>(value);
+    }
+
+    int exponent = std::bit_width(value) - 1;
+    if (exponent > kMaxExponent) {
+        return kBucketCount - 1;
+    }
+    int shift = exponent - kSubBucketBits;
+    int subBucket = static_cast<int>((value >> shift) & (kSubBuckets - 1));
+    return (shift + 1) * kSubBuckets + subBucket;
+}
+
+std::uint64_t LatencyHistogram::BucketUpperBound(int index)
+{
+    if (index < kSubBuckets) {
+        return static_cast<std::uint64_t>(index);
+    }
+
+    int shift = index / kSubBuckets - 1;
+    std::uint64_t lower = static_cast<std::uint64_t>(kSubBuckets + index % kSubBuckets) << shift;
+    return lower + (std::uint64_t{ 1 } << shift) - 1;
+}
+
+void LatencyHistogram::Record(std::uint64_t value)
+{
+    buckets[BucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    count.fetch_add(1, std::memory_order_relaxed);
+    sum.fetch_add(value, std::memory_order_relaxed);
+
+    auto previous = max.load(std::memory_order_relaxed);
+    while (value > previous && !max.compare_exchange_weak(previous, value, std::memory_order_relaxed)) {
+    }
+}
+
+void LatencyHistogram::Reset()
+{
+    for (auto& bucket : buckets) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    count.store(0, std::memory_order_relaxed);
+    sum.store(0, std::memory_order_relaxed);
+    max.store(0, std::memory_order_relaxed);
+}
+
+std::uint64_t LatencyHistogram::Percentile(double q) const
+{
+    // Sum the buckets rather than trusting count, which may be ahead of them mid-record
+    std::uint64_t total = 0;
+    for (const auto& bucket : buckets) {
+        total += bucket.load(std::memory_order_relaxed);
+    }
+    if (total == 0) {
+        return 0;
+    }
+
+    auto rank = static_cast<std::uint64_t>(std::clamp(q, 0.0, 1.0) * static_cast<double>(total - 1)) + 1;
+    std::uint64_t seen = 0;
+    for (int i = 0; i < kBucketCount; ++i) {
+        seen += buckets[i].load(std::memory_order_relaxed);
+        if (seen >= rank) {
+            // The bucket bound can overshoot the largest value actually seen
+            return std::min(BucketUpperBound(i), max.load(std::memory_order_relaxed));
+        }
+    }
+    return max.load(std::memory_order_relaxed);
+}
+
+LatencyHistogram::Summary LatencyHistogram::Summarize() const
+{
+    Summary summary;
+    summary.count = Count();
+    if (summary.count == 0) {
+        return summary;
+    }
+    summary.mean = sum.load(std::memory_order_relaxed) / summary.count;
+    summary.p50 = Percentile(0.50);
+    summary.p90 = Percentile(0.90);
+    summary.p99 = Percentile(0.99);
+    summary.max = max.load(std::memory_order_relaxed);
+    return summary;
+}
+
+Metrics* Metrics::GetSingleton()
+{
+    static Metrics singleton;
+    return &singleton;
+}
+
+const char* Metrics::ToString(Stage stage)
+{
+    switch (stage) {
+    case Stage::ReleaseToLaunch:
+        return "releaseToLaunch";
+    case Stage::PenetratingFind:
+        return "penetratingFind";
+    case Stage::Frame:
+        return "frame";
+    case Stage::TaskDrain:
+        return "taskDrain";
+    default:
+        return "?";
+    }
+}
+
+const char* Metrics::ToString(Counter counter)
+{
+    switch (counter) {
+    case Counter::AnimEvents:
+        return "animEvents";
+    case Counter::InputEvents:
+        return "inputEvents";
+    case Counter::Volleys:
+        return "volleys";
+    case Counter::ArrowsLaunched:
+        return "arrowsLaunched";
+    case Counter::LaunchFailures:
+        return "launchFailures";
+    case Counter::PenetratingShots:
+        return "penetratingShots";
+    case Counter::PenetratingMisses:
+        return "penetratingMisses";
+    case Counter::TasksDropped:
+        return "tasksDropped";
+    case Counter::TasksQueued:
+        return "tasksQueued";
+    case Counter::TasksBoxed:
+        return "tasksBoxed";
+    case Counter::NotificationsShown:
+        return "notificationsShown";
+    case Counter::NotificationsSuppressed:
+        return "notificationsSuppressed";
+    default:
+        return "?";
+    }
+}
+
+void Metrics::RecordSince(Stage stage, Clock::time_point start)
+{
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+    Record(stage, static_cast<std::uint64_t>(std::max<std::int64_t>(elapsed, 0)));
+}
+
+void Metrics::Reset()
+{
+    for (auto& histogram : histograms) {
+        histogram.Reset();
+    }
+    for (auto& counter : counters) {
+        counter.store(0, std::memory_order_relaxed);
+    }
+}
+
+std::string Metrics::FormatLine() const
+{
+    std::string line;
+    line.reserve(512);
+    for (std::size_t i = 0; i < histograms.size(); ++i) {
+        AppendStage(line, ToString(static_cast<Stage>(i)), histograms[i].Summarize());
+        line += " | ";
+    }
+    for (std::size_t i = 0; i < counters.size(); ++i) {
+        char text[64];
+        std::snprintf(text, sizeof(text), "%s%s=%llu", i ? " " : "", ToString(static_cast<Counter>(i)),
+                      static_cast<unsigned long long>(counters[i].load(std::memory_order_relaxed)));
+        line += text;
+    }
+    return line;
+}
+
+std::vector<std::string> Metrics::FormatReport() const
+{
+    std::vector<std::string> lines;
+    for (std::size_t i = 0; i < histograms.size(); ++i) {
+        auto summary = histograms[i].Summarize();
+        std::string line;
+        AppendStage(line, ToString(static_cast<Stage>(i)), summary);
+        if (summary.count > 0) {
+            line += " mean=";
+            AppendMicros(line, summary.mean);
+        }
+        lines.push_back(std::move(line));
+    }
+
+    // FormatLine's counter section, on its own
+    auto all = FormatLine();
+    lines.push_back(all.substr(all.rfind(" | ") + 3));
+    return lines;
+}
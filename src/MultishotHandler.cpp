@@ -1,10 +1,18 @@
 #include "MultishotHandler.h"
-#include "PenetratingArrowHandler.h"
+#include "ArcheryContext.h"
+#include "Ballistics.h"
 #include "Config.h"
+#include "EventRecorder.h"
+#include "FastTrig.h"
+#include "GameClock.h"
+#include "GameQueries.h"
+#include "Metrics.h"
+#include "SkyrimFacade.h"
+#include "TaskQueue.h"
+#include "Trace.h"
+#include <array>
 #include <cmath>
 #include <chrono>
-#include <numbers>
-#include <vector>
 
 MultishotHandler* MultishotHandler::GetSingleton()
 {
@@ -12,9 +20,15 @@ MultishotHandler* MultishotHandler::GetSingleton()
     return &singleton;
 }
 
+MultishotHandler::MultishotHandler() :
+    logic(*SkyrimFacade::GetSingleton(), Config::GetSingleton()->multishot)
+{
+}
+
 RE::BSEventNotifyControl MultishotHandler::ProcessEvent(RE::InputEvent* const* a_event, 
                                                        RE::BSTEventSource<RE::InputEvent*>* /*a_eventSource*/)
 {
+    Trace::Zone zone("Multishot::ProcessEvent(Input)");
     if (!a_event || !*a_event) {
         return RE::BSEventNotifyControl::kContinue;
     }
@@ -23,32 +37,18 @@ RE::BSEventNotifyControl MultishotHandler::ProcessEvent(RE::InputEvent* const* a
     if (!config->multishot.enabled) {
         return RE::BSEventNotifyControl::kContinue;
     }
-
-    for (auto* event = *a_event; event; event = event->next) {
-        if (event->GetEventType() != RE::INPUT_EVENT_TYPE::kButton) {
-            continue;
-        }
-
-        auto* buttonEvent = event->AsButtonEvent();
-        if (!buttonEvent || buttonEvent->GetDevice() != RE::INPUT_DEVICE::kKeyboard) {
-            continue;
-        }
-
-        // Check if it's our configured key and it's being pressed (not released)
-        if (buttonEvent->GetIDCode() == static_cast<std::uint32_t>(config->multishot.keyCode) && 
-            buttonEvent->IsDown()) {  // Use IsDown() for key press detection
-            
-            // Add debouncing to prevent double-triggering
-            auto now = std::chrono::steady_clock::now();
-            if ((now - lastActivationTime) >= std::chrono::milliseconds(200)) {
-                if (CanActivateReadyState()) {
-                    ActivateReadyState();
-                    lastActivationTime = now;
-                }
+    Metrics::GetSingleton()->Increment(Metrics::Counter::InputEvents);
+
+    // Our configured key being pressed (not released or held); the event passes through either way
+    auto keyCode = static_cast<std::uint32_t>(config->multishot.keyCode);
+    if (GameQueries::FindKeyPress<RE::INPUT_EVENT_TYPE::kButton, RE::INPUT_DEVICE::kKeyboard>(*a_event, keyCode)) {
+        // Add debouncing to prevent double-triggering
+        auto now = GameClock::GetSingleton()->RealNow();
+        if ((now - lastActivationTime) >= std::chrono::milliseconds(200)) {
+            EventRecorder::GetSingleton()->RecordKeyPress(keyCode);
+            if (logic.TryActivate()) {
+                lastActivationTime = now;
             }
-            
-            // Don't consume this event - let it pass through
-            break;
         }
     }
 
@@ -58,6 +58,7 @@ RE::BSEventNotifyControl MultishotHandler::ProcessEvent(RE::InputEvent* const* a
 RE::BSEventNotifyControl MultishotHandler::ProcessEvent(const RE::BSAnimationGraphEvent* a_event,
                                                        RE::BSTEventSource<RE::BSAnimationGraphEvent>* /*a_eventSource*/)
 {
+    Trace::Zone zone("Multishot::ProcessEvent(Anim)");
     if (!a_event || !a_event->holder) {
         return RE::BSEventNotifyControl::kContinue;
     }
@@ -67,10 +68,12 @@ RE::BSEventNotifyControl MultishotHandler::ProcessEvent(const RE::BSAnimationGra
     if (!player || a_event->holder != player) {
         return RE::BSEventNotifyControl::kContinue;
     }
+    Metrics::GetSingleton()->Increment(Metrics::Counter::AnimEvents);
 
     // Check for arrow release animation event 
     if (a_event->tag == "arrowRelease") {
         SKSE::log::info("Arrow release detected: {}", a_event->tag.c_str());
+        EventRecorder::GetSingleton()->RecordAnimTag(Game::Technique::Multishot, EventLog::Tag::ArrowRelease);
         OnArrowRelease();
     }
 
@@ -79,99 +82,12 @@ RE::BSEventNotifyControl MultishotHandler::ProcessEvent(const RE::BSAnimationGra
 
 void MultishotHandler::ActivateReadyState()
 {
-    // Update state before checking
-    UpdateState();
-    
-    if (currentState != MultishotState::Inactive) {
-        // Already in ready state or on cooldown
-        if (currentState == MultishotState::Ready) {
-            SKSE::log::info("Multishot already in ready state");
-            RE::DebugNotification("Multishot: Already READY");
-        } else if (currentState == MultishotState::Cooldown) {
-            float remainingCooldown = GetRemainingCooldownTime();
-            SKSE::log::info("Multishot on cooldown, {} seconds remaining", remainingCooldown);
-            RE::DebugNotification(std::format("Multishot: Cooldown ({:.0f}s)", remainingCooldown).c_str());
-        }
-        return;
-    }
-    
-    // Activate ready state
-    currentState = MultishotState::Ready;
-    readyStateStartTime = std::chrono::steady_clock::now();
-    
-    // Register animation event handler 
-    RegisterAnimationEventHandler();
-    
-    auto* config = Config::GetSingleton();
-    SKSE::log::info("Multishot ready state activated for {} seconds", config->multishot.readyWindowDuration);
-    RE::DebugNotification("Multishot: READY");
-}
-
-void MultishotHandler::RegisterAnimationEventHandler()
-{
-    static bool registered = false;
-    if (registered) {
-        return; // Already registered
-    }
-    
-    auto* player = RE::PlayerCharacter::GetSingleton();
-    if (player) {
-        RE::BSTSmartPointer<RE::BSAnimationGraphManager> animationGraphManager;
-        if (player->GetAnimationGraphManager(animationGraphManager) && animationGraphManager) {
-            if (!animationGraphManager->graphs.empty()) {
-                // Register this MultishotHandler as an animation event sink
-                animationGraphManager->graphs.front()->GetEventSource<RE::BSAnimationGraphEvent>()->AddEventSink(this);
-                SKSE::log::info("Animation event handler registered successfully");
-                registered = true;
-            } else {
-                SKSE::log::error("No animation graphs available");
-            }
-        } else {
-            SKSE::log::error("Failed to get AnimationGraphManager in toggle");
-        }
-    }
+    logic.Activate();
 }
 
 bool MultishotHandler::CanActivateReadyState()
 {
-    auto* player = RE::PlayerCharacter::GetSingleton();
-    if (!player) {
-        return false;
-    }
-
-    // Check if player is in a valid state
-    if (player->IsInKillMove() || player->IsDead()) {
-        return false;
-    }
-
-    // Check if UI is open
-    auto* ui = RE::UI::GetSingleton();
-    if (ui && ui->GameIsPaused()) {
-        return false;
-    }
-
-    // Check if a valid bow is equipped
-    auto* equippedWeapon = player->GetEquippedObject(false);
-    auto* weapon = equippedWeapon ? equippedWeapon->As<RE::TESObjectWEAP>() : nullptr;
-    
-    if (!IsValidBow(weapon)) {
-        return false;
-    }
-
-    // Check if perk is required and if player has it
-    auto* config = Config::GetSingleton();
-    if (config->enablePerks) {
-        if (!Config::HasMultishotPerk()) {
-            SKSE::log::debug("Multishot: Player does not have required perk");
-            return false;
-        }
-    }
-
-    // Update state to check for transitions
-    UpdateState();
-    
-    // Can only activate if currently inactive
-    return currentState == MultishotState::Inactive;
+    return logic.CanActivate();
 }
 
 bool MultishotHandler::IsValidBow(RE::TESObjectWEAP* weapon)
@@ -187,63 +103,13 @@ bool MultishotHandler::IsValidBow(RE::TESObjectWEAP* weapon)
 
 void MultishotHandler::OnArrowRelease()
 {
-    // Update state to handle any transitions
-    UpdateState();
-    
-    if (currentState != MultishotState::Ready) {
-        return; // Normal shot, do nothing
-    }
-
-    auto* player = RE::PlayerCharacter::GetSingleton();
-    if (!player) {
-        return;
-    }
-
-    auto* config = Config::GetSingleton();
-    int arrowCount = config->multishot.arrowCount;
-    
-    if (arrowCount < 2) {
-        return;
-    }
-
-    // The vanilla arrow has already been fired, so we fire (arrowCount - 1) additional arrows
-    int additionalArrows = arrowCount - 1;
-    
-    if (!HasSufficientAmmo(additionalArrows)) {
-        SKSE::log::info("Insufficient ammo for multishot");
-        RE::DebugNotification("Multishot: Insufficient ammo");
-        return;
-    }
-
-    auto* equippedWeapon = player->GetEquippedObject(false);
-    auto* weapon = equippedWeapon ? equippedWeapon->As<RE::TESObjectWEAP>() : nullptr;
-    auto* ammo = player->GetCurrentAmmo();
-
-    if (!weapon || !ammo) {
-        return;
-    }
-
-    // Transition to cooldown state
-    currentState = MultishotState::Cooldown;
-    cooldownStartTime = std::chrono::steady_clock::now();
-    
-    SKSE::log::info("Multishot triggered! Starting cooldown for {} seconds", config->multishot.cooldownDuration);
-    RE::DebugNotification(std::format("Multishot: Cooldown ({:.0f}s)", config->multishot.cooldownDuration).c_str());
-
-    // Delay multishot launch to let vanilla arrow launch completely first
-    auto* taskInterface = SKSE::GetTaskInterface();
-    if (!taskInterface) {
-        return;
-    }
-
-    // Capture all needed data for the delayed launch
-    taskInterface->AddTask([this, player, weapon, ammo, arrowCount, additionalArrows]() {
-        LaunchMultishotArrows(player, weapon, ammo, arrowCount, additionalArrows);
-    });
+    // Launches are queued through the facade once the cooldown has started
+    logic.OnArrowRelease();
 }
 
 void MultishotHandler::LaunchMultishotArrows(RE::PlayerCharacter* player, RE::TESObjectWEAP* weapon, RE::TESAmmo* ammo, int arrowCount, int additionalArrows)
 {
+    Trace::Zone zone("Multishot::LaunchVolley");
     auto* config = Config::GetSingleton();
     if (!config) {
         SKSE::log::error("Could not get config singleton");
@@ -275,170 +141,153 @@ void MultishotHandler::LaunchMultishotArrows(RE::PlayerCharacter* player, RE::TE
     // Calculate the target velocity magnitude from weapon speed
     float arrowSpeed = weapon->weaponData.speed * 1500.0f;
     
-    SKSE::log::info("Firing {} additional arrows with spread angle {}", additionalArrows, config->multishot.spreadAngle);
-    SKSE::log::info("DEBUG: Base pitch: {:.3f}°, yaw: {:.3f}°, target speed: {:.3f}", 
-                   baseAngles.x * 180.0f / std::numbers::pi_v<float>,
-                   baseAngles.z * 180.0f / std::numbers::pi_v<float>,
+    // Per-shot detail is debug level: spdlog skips formatting below the
+    // configured level, so a release build's volley stays off the heap
+    SKSE::log::debug("Firing {} additional arrows with spread angle {} ({} pattern)", additionalArrows, config->multishot.spreadAngle,
+                   SpreadPatterns::ToString(config->multishot.spreadPattern));
+    SKSE::log::debug("Base pitch: {:.3f}°, yaw: {:.3f}°, target speed: {:.3f}", 
+                   FastTrig::ToDegrees(baseAngles.x),
+                   FastTrig::ToDegrees(baseAngles.z),
                    arrowSpeed);
     
-    // Calculate spread pattern
-    float totalSpread = config->multishot.spreadAngle * (arrowCount - 1);
-    float startAngle = -totalSpread / 2.0f;
-    float angleIncrement = (arrowCount > 1) ? totalSpread / (arrowCount - 1) : 0.0f;
-    
-    struct ArrowData {
-        RE::ProjectileHandle handle;
-        float targetSpeed;
-    };
-    std::vector<ArrowData> launchedArrows;
+    // Get camera right/up vectors for the origin offset
+    RE::NiPoint3 rightVector{};
+    RE::NiPoint3 upVector{};
+    auto* camera = RE::PlayerCamera::GetSingleton();
+    if (camera && camera->cameraRoot) {
+        rightVector = camera->cameraRoot->world.rotate.GetVectorX();
+        upVector = camera->cameraRoot->world.rotate.GetVectorZ();
+    }
     
-    // Launch each arrow with modified yaw angle (horizontal spread only)
-    int centerIndex = (arrowCount - 1) / 2; // For 3 arrows, center is at index 1
+    Volley::Input input;
+    input.origin[0] = origin.x;
+    input.origin[1] = origin.y;
+    input.origin[2] = origin.z;
+    input.pitch = baseAngles.x;
+    input.yaw = baseAngles.z;
+    input.cameraRight[0] = rightVector.x;
+    input.cameraRight[1] = rightVector.y;
+    input.cameraRight[2] = rightVector.z;
+    input.cameraUp[0] = upVector.x;
+    input.cameraUp[1] = upVector.y;
+    input.cameraUp[2] = upVector.z;
+    input.arrowCount = arrowCount;
+    if (auto* projectileBase = ammo->GetRuntimeData().data.projectile) {
+        input.projectileSpeed = projectileBase->data.speed;
+        input.projectileGravity = projectileBase->data.gravity * Ballistics::kGravityUnits;
+    }
     
-    for (int i = 0; i < arrowCount; ++i) {
-        if (i == centerIndex) {
-            continue;
+    // Launches each arrow as the volley lays it out and sets its power and
+    // speedMult straight away, so no list of launched handles is kept
+    class ArrowLauncher : public Volley::Launcher
+    {
+    public:
+        ArrowLauncher(RE::PlayerCharacter* player, RE::TESObjectWEAP* weapon, RE::TESAmmo* ammo) :
+            player(player), weapon(weapon), ammo(ammo)
+        {
         }
-        
-        float currentSpread = startAngle + (i * angleIncrement);
-        float spreadRadians = currentSpread * std::numbers::pi_v<float> / 180.0f;
-        
-        // Apply spread to yaw angle only (horizontal spread)
-        float adjustedAngleZ = baseAngles.z + spreadRadians;
-        
-        // Calculate offset position to prevent arrow collision
-        RE::NiPoint3 offsetOrigin = origin;
-        
-        // Get camera right vector for horizontal offset
-        auto* camera = RE::PlayerCamera::GetSingleton();
-        if (camera && camera->cameraRoot) {
-            auto* cameraNode = camera->cameraRoot.get();
-            if (cameraNode) {
-                // Get right vector from camera (perpendicular to view direction)
-                RE::NiPoint3 rightVector = cameraNode->world.rotate.GetVectorX();
-                
-                // Offset by 5 units per arrow position from center
-                float offsetDistance = (i - centerIndex) * 5.0f;
-                offsetOrigin.x += rightVector.x * offsetDistance;
-                offsetOrigin.y += rightVector.y * offsetDistance;
-                offsetOrigin.z += rightVector.z * offsetDistance;
-                
-                SKSE::log::info("DEBUG: Arrow {} offset by {:.3f} units horizontally", i, offsetDistance);
+
+        bool Launch(int slot, const std::array<float, 3>& origin, float pitch, float yaw) override
+        {
+            SKSE::log::debug("Arrow {} - Pitch: {:.3f}°, Yaw: {:.3f}°", slot, FastTrig::ToDegrees(pitch), FastTrig::ToDegrees(yaw));
+
+            // Use LaunchArrow with the offset origin and spread angles
+            RE::NiPoint3 arrowOrigin{ origin[0], origin[1], origin[2] };
+            RE::ProjectileHandle projectileHandle;
+            if (!RE::Projectile::LaunchArrow(&projectileHandle, player, ammo, weapon, arrowOrigin, RE::Projectile::ProjectileRot{ pitch, yaw })) {
+                SKSE::log::error("Arrow {} failed to launch", slot);
+                return false;
             }
-        }
-        
-        SKSE::log::info("DEBUG: Arrow {} - Spread: {:.3f}°, Pitch: {:.3f}°, Yaw: {:.3f}°", 
-                       i, currentSpread,
-                       baseAngles.x * 180.0f / std::numbers::pi_v<float>,
-                       adjustedAngleZ * 180.0f / std::numbers::pi_v<float>);
-        
-        // Use LaunchArrow with the offset origin and spread angles
-        RE::ProjectileHandle projectileHandle;
-        if (RE::Projectile::LaunchArrow(&projectileHandle, player, ammo, weapon, offsetOrigin, 
-                                       RE::Projectile::ProjectileRot{baseAngles.x, adjustedAngleZ})) {
-            launchedArrows.push_back({projectileHandle, arrowSpeed});
-            SKSE::log::info("DEBUG: Arrow {} launched successfully", i);
-        } else {
-            SKSE::log::error("DEBUG: Arrow {} failed to launch", i);
-        }
-    }
-    
-    // Set speedMult and power immediately for launched arrows
-    for (const auto& arrowData : launchedArrows) {
-        auto projectilePtr = arrowData.handle.get();
-        if (projectilePtr) {
-            auto* proj = projectilePtr.get();
-            if (proj) {
+            SKSE::log::debug("Arrow {} launched successfully", slot);
+
+            auto projectilePtr = projectileHandle.get();
+            if (auto* proj = projectilePtr.get()) {
                 auto& runtimeData = proj->GetProjectileRuntimeData();
                 runtimeData.power = 1.0f;
                 runtimeData.speedMult = 1.0f;
-                
-                SKSE::log::info("DEBUG: Set power={:.3f}, speedMult={:.3f} for multishot arrow", 
-                              runtimeData.power, runtimeData.speedMult);
+                SKSE::log::debug("Set power={:.3f}, speedMult={:.3f} for multishot arrow", runtimeData.power, runtimeData.speedMult);
             }
+            return true;
         }
+
+    private:
+        RE::PlayerCharacter* player;
+        RE::TESObjectWEAP* weapon;
+        RE::TESAmmo* ammo;
+    };
+
+    ArrowLauncher launcher(player, weapon, ammo);
+    auto [volley, launched] = Volley::Fire(input, config->multishot, launcher);
+    if (volley.convergenceSkipped) {
+        SKSE::log::warn("Multishot convergence: ammo has no projectile, keeping spread angles");
+    } else if (volley.unreachable > 0) {
+        SKSE::log::debug("Multishot convergence: {} of {} pattern points out of range", volley.unreachable, volley.count);
     }
     
-    // Add debugging for vanilla arrow using a task
-    if (!launchedArrows.empty()) {
-        auto* taskInterface = SKSE::GetTaskInterface();
-        if (taskInterface) {
-            taskInterface->AddTask([player]() {
-                // Find and debug the vanilla arrow
-                auto* projectileManager = RE::Projectile::Manager::GetSingleton();
-                if (!projectileManager) {
-                    return;
-                }
-                
-                SKSE::log::info("DEBUG: Searching for vanilla arrow...");
-                int playerArrowsFound = 0;
+    auto* metrics = Metrics::GetSingleton();
+    metrics->Increment(Metrics::Counter::Volleys);
+    metrics->Increment(Metrics::Counter::ArrowsLaunched, static_cast<std::uint64_t>(launched));
+    metrics->Increment(Metrics::Counter::LaunchFailures, static_cast<std::uint64_t>(volley.count - launched));
+    
+    if (launched == 0) {
+        return;
+    }
+
+    // Add debugging for vanilla arrow using a task; it only feeds debug lines,
+    // so it is not queued at all otherwise
+    if (spdlog::should_log(spdlog::level::debug)) {
+        // Debug output only, so it is simply dropped if the queue is full
+        TaskQueue::GetSingleton()->Push([player]() {
+            Trace::Zone zone("Task: Multishot vanilla arrow debug");
+            // Find and debug the vanilla arrow
+            auto* projectileManager = RE::Projectile::Manager::GetSingleton();
+            if (!projectileManager) {
+                return;
+            }
+            
+            SKSE::log::debug("Searching for vanilla arrow...");
+            int playerArrowsFound = 0;
+            
+            // Check unlimited projectiles
+            for (auto& projectileHandle : projectileManager->unlimited) {
+                auto projectilePtr = projectileHandle.get();
+                auto* projectile = projectilePtr ? projectilePtr.get() : nullptr;
                 
-                // Check unlimited projectiles
-                for (auto& projectileHandle : projectileManager->unlimited) {
-                    auto projectilePtr = projectileHandle.get();
-                    auto* projectile = projectilePtr ? projectilePtr.get() : nullptr;
+                if (projectile && projectile->IsMissileProjectile()) {
+                    auto& projData = projectile->GetProjectileRuntimeData();
+                    
+                    // Check if this is a player arrow
+                    auto shooterHandle = projData.shooter.get();
+                    auto* shooter = shooterHandle ? shooterHandle.get() : nullptr;
                     
-                    if (projectile && projectile->IsMissileProjectile()) {
-                        auto& projData = projectile->GetProjectileRuntimeData();
+                    if (shooter == player && projData.livingTime < 0.2f) {
+                        playerArrowsFound++;
                         
-                        // Check if this is a player arrow
-                        auto shooterHandle = projData.shooter.get();
-                        auto* shooter = shooterHandle ? shooterHandle.get() : nullptr;
+                        auto velocity = projData.velocity;
+                        float speed = velocity.Length();
                         
-                        if (shooter == player && projData.livingTime < 0.2f) {
-                            playerArrowsFound++;
-                            
-                            auto velocity = projData.velocity;
-                            float speed = velocity.Length();
-                            
-                            SKSE::log::info("DEBUG: Player arrow #{} - livingTime: {:.3f}s, velocity: ({:.3f}, {:.3f}, {:.3f}), speed: {:.3f}, power: {:.3f}, speedMult: {:.3f}", 
-                                          playerArrowsFound, projData.livingTime,
-                                          velocity.x, velocity.y, velocity.z, speed,
-                                          projData.power, projData.speedMult);
-                        }
+                        SKSE::log::debug("Player arrow #{} - livingTime: {:.3f}s, velocity: ({:.3f}, {:.3f}, {:.3f}), speed: {:.3f}, power: {:.3f}, speedMult: {:.3f}", 
+                                      playerArrowsFound, projData.livingTime,
+                                      velocity.x, velocity.y, velocity.z, speed,
+                                      projData.power, projData.speedMult);
                     }
                 }
-                
-                SKSE::log::info("DEBUG: Found {} player arrows total", playerArrowsFound);
-            });
-        }
-        
-        ConsumeAmmo(static_cast<int>(launchedArrows.size()));
-        SKSE::log::info("Successfully launched {} additional arrows", launchedArrows.size());
-    }
-}
-
-bool MultishotHandler::HasSufficientAmmo(int requiredCount)
-{
-    auto* player = RE::PlayerCharacter::GetSingleton();
-    if (!player) {
-        return false;
-    }
-
-    auto* ammo = player->GetCurrentAmmo();
-    if (!ammo) {
-        return false;
-    }
-
-    auto inventory = player->GetInventory();
-    auto it = inventory.find(ammo);
-    if (it != inventory.end()) {
-        auto& [count, entry] = it->second;
-        return count >= requiredCount;
+            }
+            
+            SKSE::log::debug("Found {} player arrows total", playerArrowsFound);
+        });
     }
 
-    return false;
+    ConsumeAmmo(launched);
+    SKSE::log::debug("Successfully launched {} additional arrows", launched);
 }
 
 void MultishotHandler::ConsumeAmmo(int count)
 {
-    auto* player = RE::PlayerCharacter::GetSingleton();
-    if (!player) {
-        return;
-    }
-
-    auto* ammo = player->GetCurrentAmmo();
-    if (!ammo) {
+    const auto& context = ArcheryContextService::Get();
+    auto* player = context.player;
+    auto* ammo = context.ammo;
+    if (!player || !ammo) {
         return;
     }
 
@@ -451,66 +300,45 @@ void MultishotHandler::ConsumeAmmo(int count)
 // State query methods
 bool MultishotHandler::IsInReadyState() const
 {
-    return currentState == MultishotState::Ready;
+    return logic.IsReady();
 }
 
 bool MultishotHandler::IsOnCooldown() const
 {
-    return currentState == MultishotState::Cooldown;
+    return logic.IsOnCooldown();
 }
 
 MultishotState MultishotHandler::GetCurrentState() const
 {
-    return currentState;
+    return logic.GetState();
 }
 
 float MultishotHandler::GetRemainingReadyTime() const
 {
-    if (currentState != MultishotState::Ready) {
-        return 0.0f;
-    }
-    
-    auto* config = Config::GetSingleton();
-    auto now = std::chrono::steady_clock::now();
-    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - readyStateStartTime).count() / 1000.0f;
-    float remaining = config->multishot.readyWindowDuration - elapsed;
-    return std::max(0.0f, remaining);
+    return logic.GetRemainingReadyTime();
 }
 
 float MultishotHandler::GetRemainingCooldownTime() const
 {
-    if (currentState != MultishotState::Cooldown) {
-        return 0.0f;
-    }
-    
-    auto* config = Config::GetSingleton();
-    auto now = std::chrono::steady_clock::now();
-    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - cooldownStartTime).count() / 1000.0f;
-    float remaining = config->multishot.cooldownDuration - elapsed;
-    return std::max(0.0f, remaining);
+    return logic.GetRemainingCooldownTime();
 }
 
 void MultishotHandler::UpdateState()
 {
-    auto* config = Config::GetSingleton();
-    auto now = std::chrono::steady_clock::now();
-    
-    if (currentState == MultishotState::Ready) {
-        // Check if ready window has expired
-        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - readyStateStartTime).count() / 1000.0f;
-        if (elapsed >= config->multishot.readyWindowDuration) {
-            currentState = MultishotState::Inactive;
-            SKSE::log::info("Multishot ready window expired");
-            RE::DebugNotification("Multishot: Expired");
-        }
-    } else if (currentState == MultishotState::Cooldown) {
-        // Check if cooldown has finished
-        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - cooldownStartTime).count() / 1000.0f;
-        if (elapsed >= config->multishot.cooldownDuration) {
-            currentState = MultishotState::Inactive;
-            SKSE::log::info("Multishot cooldown finished");
-            RE::DebugNotification("Multishot: Ready to activate");
-        }
-    }
-    
+    logic.Update();
+}
+
+void MultishotHandler::Save(TechniqueRecord::Record& record) const
+{
+    logic.Save(record);
+}
+
+void MultishotHandler::Load(const TechniqueRecord::Entry& entry)
+{
+    logic.Load(entry);
+}
+
+void MultishotHandler::Revert()
+{
+    logic.Revert();
 }
\ No newline at end of file
@@ -0,0 +1,65 @@
+#include "NotificationQueue.h"
+#include "Metrics.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+namespace {
+    bool SameText(const NotificationQueue::Text& a, const NotificationQueue::Text& b)
+    {
+        return std::strcmp(a.data(), b.data()) == 0;
+    }
+}
+
+NotificationQueue* NotificationQueue::GetSingleton()
+{
+    static NotificationQueue singleton;
+    return &singleton;
+}
+
+void NotificationQueue::Post(Channel channel, std::string_view text)
+{
+    auto length = std::min(text.size(), kMaxLength);
+
+    std::lock_guard guard(lock);
+    auto& state = channels[static_cast<std::size_t>(channel)];
+    if (state.hasPending) {
+        Metrics::GetSingleton()->Increment(Metrics::Counter::NotificationsSuppressed);
+    }
+    std::memcpy(state.pending.data(), text.data(), length);
+    state.pending[length] = '\0';
+    state.hasPending = true;
+}
+
+NotificationQueue::Batch NotificationQueue::TakeDue(GameClock::RealTime now, float interval)
+{
+    Batch batch;
+    std::size_t suppressed = 0;
+    {
+        std::lock_guard guard(lock);
+        for (auto& state : channels) {
+            if (!state.hasPending) {
+                continue;
+            }
+            bool due = !state.hasShown || now - state.shownAt >= std::chrono::duration<float>(interval);
+            if (!due) {
+                if (SameText(state.pending, state.shown)) {
+                    state.hasPending = false;
+                    ++suppressed;
+                }
+                continue;
+            }
+
+            state.shown = state.pending;
+            state.shownAt = now;
+            state.hasShown = true;
+            state.hasPending = false;
+            batch.messages[batch.count++] = state.shown;
+        }
+    }
+
+    auto* metrics = Metrics::GetSingleton();
+    metrics->Increment(Metrics::Counter::NotificationsShown, batch.count);
+    metrics->Increment(Metrics::Counter::NotificationsSuppressed, suppressed);
+    return batch;
+}
@@ -1,11 +1,19 @@
 #include "PenetratingArrowHandler.h"
+#include "ActorBroadphase.h"
+#include "BowDrawTracker.h"
 #include "Config.h"
+#include "EventRecorder.h"
+#include "GameClock.h"
+#include "GameQueries.h"
+#include "Metrics.h"
 #include "MultishotHandler.h"
+#include "PenetrationEngine.h"
+#include "SkyrimFacade.h"
+#include "Trace.h"
 #include <RE/A/ArrowProjectile.h>
 #include <RE/M/MissileProjectile.h>
+#include <array>
 #include <cmath>
-#include <chrono>
-#include <numbers>
 
 PenetratingArrowHandler* PenetratingArrowHandler::GetSingleton()
 {
@@ -13,9 +21,15 @@ PenetratingArrowHandler* PenetratingArrowHandler::GetSingleton()
     return &singleton;
 }
 
+PenetratingArrowHandler::PenetratingArrowHandler() :
+    logic(*SkyrimFacade::GetSingleton(), Config::GetSingleton()->penetratingArrow, MultishotHandler::GetSingleton()->GetLogic())
+{
+}
+
 RE::BSEventNotifyControl PenetratingArrowHandler::ProcessEvent(const RE::BSAnimationGraphEvent* a_event,
                                                              RE::BSTEventSource<RE::BSAnimationGraphEvent>* /*a_eventSource*/)
 {
+    Trace::Zone zone("PenetratingArrow::ProcessEvent(Anim)");
     if (!a_event || !a_event->holder) {
         return RE::BSEventNotifyControl::kContinue;
     }
@@ -26,22 +40,36 @@ RE::BSEventNotifyControl PenetratingArrowHandler::ProcessEvent(const RE::BSAnima
         return RE::BSEventNotifyControl::kContinue;
     }
 
+    Metrics::GetSingleton()->Increment(Metrics::Counter::AnimEvents);
+
     // Debug: Log all animation events to see what's available
     SKSE::log::debug("PenetratingArrow: Animation event received: {}", a_event->tag.c_str());
     
+    auto tag = EventLog::ClassifyTag(std::string_view(a_event->tag));
+    EventRecorder::GetSingleton()->RecordAnimTag(Game::Technique::PenetratingArrow, tag);
+
+    // In VR the draw tracker reports start/stop from the bow itself; only the release comes from here
+    if (BowDrawTracker::GetSingleton()->IsActive() && tag != EventLog::Tag::ArrowRelease) {
+        return RE::BSEventNotifyControl::kContinue;
+    }
+
     // Check for bow draw and arrow release animation events
-    if (a_event->tag == "bowDraw" || a_event->tag == "bowDrawStart") {
+    switch (tag) {
+    case EventLog::Tag::BowDraw:
         SKSE::log::info("PenetratingArrow: Bow draw started");
         OnBowDrawStart();
-    } else if (a_event->tag == "arrowRelease") {
+        break;
+    case EventLog::Tag::ArrowRelease:
         SKSE::log::info("PenetratingArrow: Arrow release detected");
         OnArrowRelease();
-    } else if (a_event->tag == "bowDrawStop" || a_event->tag == "bowRelease" || 
-               a_event->tag == "bowUnDraw" || a_event->tag == "weaponSwing" ||
-               a_event->tag == "weaponLeftSwing") {
+        break;
+    case EventLog::Tag::BowDrawStop:
         // These events indicate the bow is no longer being drawn
         SKSE::log::info("PenetratingArrow: Bow draw stopped (event: {})", a_event->tag.c_str());
         OnBowDrawStop();
+        break;
+    default:
+        break;
     }
 
     return RE::BSEventNotifyControl::kContinue;
@@ -50,10 +78,12 @@ RE::BSEventNotifyControl PenetratingArrowHandler::ProcessEvent(const RE::BSAnima
 RE::BSEventNotifyControl PenetratingArrowHandler::ProcessEvent(RE::InputEvent* const* a_event, 
                                                              RE::BSTEventSource<RE::InputEvent*>* /*a_eventSource*/)
 {
+    Trace::Zone zone("PenetratingArrow::ProcessEvent(Input)");
     if (!a_event || !*a_event) {
         return RE::BSEventNotifyControl::kContinue;
     }
     
+    Metrics::GetSingleton()->Increment(Metrics::Counter::InputEvents);
     Update();
     
     return RE::BSEventNotifyControl::kContinue;
@@ -66,19 +96,9 @@ void PenetratingArrowHandler::Update()
         return;
     }
 
-    static bool registrationSuccessful = false;
-    if (!registrationSuccessful) {
-        auto* player = RE::PlayerCharacter::GetSingleton();
-        if (player) {
-            RE::BSTSmartPointer<RE::BSAnimationGraphManager> animationGraphManager;
-            if (player->GetAnimationGraphManager(animationGraphManager) && animationGraphManager) {
-                if (!animationGraphManager->graphs.empty()) {
-                    animationGraphManager->graphs.front()->GetEventSource<RE::BSAnimationGraphEvent>()->AddEventSink(this);
-                    SKSE::log::info("PenetratingArrow: Animation event handler registered successfully");
-                    registrationSuccessful = true;
-                }
-            }
-        }
+    // Input events arrive many times a frame; the frame hook has already updated this frame
+    if (!updateGate.Enter(GameClock::GetSingleton()->FrameNumber())) {
+        return;
     }
 
     // Debug: Log that update is being called (only occasionally to avoid spam)
@@ -94,167 +114,41 @@ void PenetratingArrowHandler::Update()
         SKSE::log::debug("PenetratingArrow: Update called (counter: {})", updateCounter);
     }
 
-    UpdateBowDrawState();
-    CheckForStateTransitions();
+    EventRecorder::GetSingleton()->RecordUpdate();
+    logic.Update();
     
     // Also update the multishot system to ensure its notifications work properly
     // The multishot system doesn't have its own update loop, so we help it here
     MultishotHandler::GetSingleton()->UpdateState();
 }
 
-void PenetratingArrowHandler::UpdateBowDrawState()
-{
-    auto* player = RE::PlayerCharacter::GetSingleton();
-    if (!player) {
-        return;
-    }
-
-    // Check if player is in a valid state
-    if (player->IsInKillMove() || player->IsDead()) {
-        ResetState();
-        return;
-    }
-
-    // Check if UI is open
-    auto* ui = RE::UI::GetSingleton();
-    if (ui && ui->GameIsPaused()) {
-        return; // Don't reset state, just pause tracking
-    }
-
-    // Check if a valid bow is equipped
-    auto* equippedWeapon = player->GetEquippedObject(false);
-    auto* weapon = equippedWeapon ? equippedWeapon->As<RE::TESObjectWEAP>() : nullptr;
-    
-    if (!IsValidBow(weapon)) {
-        ResetState();
-        return;
-    }
-
-    // Check if multishot is active - if so, reset penetrating arrow state
-    auto* multishotHandler = MultishotHandler::GetSingleton();
-    if (multishotHandler->IsInReadyState()) {
-        if (currentState == PenetratingArrowState::Charging || currentState == PenetratingArrowState::Charged) {
-            SKSE::log::info("PenetratingArrow: Multishot activated - resetting penetrating arrow state");
-            ResetState();
-        }
-        return;
-    }
-
-    // Check if player is still continuously drawing
-    // Bow draw events fire every ~500-700ms while actively drawing
-    // If we haven't seen one in >2 seconds, player stopped drawing mid-charge
-    if (currentState == PenetratingArrowState::Charging) {
-        auto now = std::chrono::steady_clock::now();
-        auto timeSinceLastBowDraw = std::chrono::duration_cast<std::chrono::milliseconds>(now - lastBowDrawTime).count();
-        
-        // If it's been more than 2 seconds since the last bow draw event,
-        // the player stopped drawing (events fire every ~500-700ms when drawing)
-        if (timeSinceLastBowDraw > 2000) {
-            SKSE::log::info("PenetratingArrow: No bow draw events for {}ms - player stopped drawing, resetting", timeSinceLastBowDraw);
-            ResetState();
-        }
-    }
-}
-
-void PenetratingArrowHandler::CheckForStateTransitions()
+void PenetratingArrowHandler::OnBowDrawStart()
 {
-    auto* config = Config::GetSingleton();
-    auto now = std::chrono::steady_clock::now();
-    
-    if (currentState == PenetratingArrowState::Charging) {
-        // Check if charging time has elapsed
-        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - chargingStartTime).count() / 1000.0f;
-        if (elapsed >= config->penetratingArrow.chargeTime) {
-            currentState = PenetratingArrowState::Charged;
-            SKSE::log::info("PenetratingArrow: Arrow fully charged!");
-            // RE::DebugNotification("Penetrating Arrow: CHARGED");
-        }
-    } else if (currentState == PenetratingArrowState::Cooldown) {
-        // Check if cooldown has finished
-        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - cooldownStartTime).count() / 1000.0f;
-        if (elapsed >= config->penetratingArrow.cooldownDuration) {
-            currentState = PenetratingArrowState::Inactive;
-            SKSE::log::info("PenetratingArrow: Cooldown finished");
-            // RE::DebugNotification("Penetrating Arrow: Ready");
-        }
-    }
+    logic.OnBowDrawStart();
 }
 
-void PenetratingArrowHandler::OnBowDrawStart()
+void PenetratingArrowHandler::OnDrawFrame(float drawStrength, float delta)
 {
-    // Always update the last bow draw time when we receive bow draw events
-    lastBowDrawTime = std::chrono::steady_clock::now();
-    
-    if (currentState == PenetratingArrowState::Inactive) {
-        if (CanStartCharging()) {
-            StartCharging();
-        }
-    }
-    // If we receive a bow draw event while charging, update the last draw time
-    else if (currentState == PenetratingArrowState::Charging) {
-        // Bow draw event received - player is still drawing
-        SKSE::log::debug("PenetratingArrow: Bow draw event while charging - continuous draw confirmed");
-    }
+    logic.OnDrawFrame(drawStrength, delta);
 }
 
 void PenetratingArrowHandler::OnBowDrawStop()
 {
-    // Reset state on any bow draw stop event - player released the bow without firing
-    if (currentState == PenetratingArrowState::Charging) {
+    if (logic.IsCharging()) {
         SKSE::log::info("PenetratingArrow: Bow draw stopped while charging - resetting state");
-        ResetState();
     }
+    logic.OnBowDrawStop();
 }
 
 void PenetratingArrowHandler::OnArrowRelease()
 {
-    if (currentState != PenetratingArrowState::Charged) {
-        return; // Normal shot, do nothing
-    }
-
-    auto* player = RE::PlayerCharacter::GetSingleton();
-    if (!player) {
-        return;
-    }
-
-    auto* equippedWeapon = player->GetEquippedObject(false);
-    auto* weapon = equippedWeapon ? equippedWeapon->As<RE::TESObjectWEAP>() : nullptr;
-    auto* ammo = player->GetCurrentAmmo();
-
-    if (!weapon || !ammo) {
-        ResetState();
-        return;
-    }
-
-    // Transition to cooldown state
-    currentState = PenetratingArrowState::Cooldown;
-    cooldownStartTime = std::chrono::steady_clock::now();
-    
-    auto* config = Config::GetSingleton();
-    SKSE::log::info("PenetratingArrow: Penetrating shot fired! Starting cooldown for {} seconds", 
-                   config->penetratingArrow.cooldownDuration);
-    RE::DebugNotification(std::format("Penetrating Arrow: Cooldown ({:.0f}s)", 
-                                     config->penetratingArrow.cooldownDuration).c_str());
-
-    // Add a very small delay to let the game create the arrow first
-    auto* taskInterface = SKSE::GetTaskInterface();
-    if (taskInterface) {
-        taskInterface->AddTask([this, player, weapon, ammo]() {
-            // Small delay to ensure arrow exists
-            std::this_thread::sleep_for(std::chrono::milliseconds(50));
-            
-            auto* taskInterface2 = SKSE::GetTaskInterface();
-            if (taskInterface2) {
-                taskInterface2->AddTask([this, player, weapon, ammo]() {
-                    LaunchPenetratingArrow(player, weapon, ammo);
-                });
-            }
-        });
-    }
+    // The launch is queued through the facade once the cooldown has started
+    logic.OnArrowRelease();
 }
 
 void PenetratingArrowHandler::LaunchPenetratingArrow(RE::PlayerCharacter* player, RE::TESObjectWEAP* /*weapon*/, RE::TESAmmo* /*ammo*/)
 {
+    Trace::Zone zone("PenetratingArrow::Launch");
     SKSE::log::info("PenetratingArrow: Modifying arrow for penetrating behavior");
     
     // Find the most recently fired arrow and modify it
@@ -267,6 +161,7 @@ void PenetratingArrowHandler::LaunchPenetratingArrow(RE::PlayerCharacter* player
     RE::Projectile* targetArrow = nullptr;
     float shortestLivingTime = 0.5f; // Look at recent arrows (with 50ms delay this should be ~0.05s)
     int playerArrowsFound = 0;
+    auto playerHandle = player->GetHandle();
     
     SKSE::log::debug("PenetratingArrow: Searching for player arrows in all projectile arrays...");
     
@@ -277,35 +172,36 @@ void PenetratingArrowHandler::LaunchPenetratingArrow(RE::PlayerCharacter* player
             auto projectilePtr = projectileHandle.get();
             auto* projectile = projectilePtr ? projectilePtr.get() : nullptr;
             
-            if (projectile && projectile->IsMissileProjectile()) {
-                auto& projData = projectile->GetProjectileRuntimeData();
-                
-                // Check if this is a player arrow
-                auto shooterHandle = projData.shooter.get();
-                auto* shooter = shooterHandle ? shooterHandle.get() : nullptr;
-                
-                if (shooter == player) {
-                    playerArrowsFound++;
-                    SKSE::log::debug("PenetratingArrow: Found player arrow in {} with livingTime: {:.3f}s", arrayName, projData.livingTime);
-                    
-                    if (projData.livingTime < shortestLivingTime) {
-                        targetArrow = projectile;
-                        shortestLivingTime = projData.livingTime;
-                        SKSE::log::debug("PenetratingArrow: This is the newest arrow so far (from {})", arrayName);
-                    }
-                }
+            if (!projectile) {
+                continue;
+            }
+            
+            auto& projData = projectile->GetProjectileRuntimeData();
+            if (!GameQueries::IsNewerPlayerArrow(projData.livingTime, shortestLivingTime, projData.shooter, playerHandle,
+                                                 [projectile] { return projectile->IsMissileProjectile(); })) {
+                continue;
             }
+            
+            playerArrowsFound++;
+            targetArrow = projectile;
+            shortestLivingTime = projData.livingTime;
+            SKSE::log::debug("PenetratingArrow: Newest player arrow so far in {} with livingTime: {:.3f}s", arrayName, projData.livingTime);
         }
     };
     
     // Search all three projectile arrays
-    searchArray(projectileManager->pending, "pending");
-    searchArray(projectileManager->unlimited, "unlimited");
-    searchArray(projectileManager->limited, "limited");
+    {
+        Metrics::ScopedTimer findTimer(Metrics::Stage::PenetratingFind);
+        Trace::Zone findZone("PenetratingArrow::FindProjectile");
+        searchArray(projectileManager->pending, "pending");
+        searchArray(projectileManager->unlimited, "unlimited");
+        searchArray(projectileManager->limited, "limited");
+    }
     
-    SKSE::log::info("PenetratingArrow: Found {} player arrows total across all arrays", playerArrowsFound);
+    SKSE::log::info("PenetratingArrow: Found {} recent player arrows across all arrays", playerArrowsFound);
     
     if (targetArrow) {
+        Metrics::GetSingleton()->Increment(Metrics::Counter::PenetratingShots);
         auto& projData = targetArrow->GetProjectileRuntimeData();
         
         // Modify projectile for penetrating behavior
@@ -332,154 +228,75 @@ void PenetratingArrowHandler::LaunchPenetratingArrow(RE::PlayerCharacter* player
             SKSE::log::info("PenetratingArrow: Set impactResult to kImpale for penetration with damage");
         }
         
-        SKSE::log::info("PenetratingArrow: Using selective penetration - should hit NPCs but pass through them");
+        // The actors in the line of fire are the ones the arrow may pass through
+        std::array<RE::FormID, PenetrationEngine::kMaxHitsPerArrow> inPath{};
+        std::size_t predicted = 0;
+        float speed = projData.linearVelocity.Length();
+        if (speed > 0.0f) {
+            predicted = ActorBroadphase::GetSingleton()->QueryRay(targetArrow->GetPosition(), projData.linearVelocity / speed,
+                                                                  projData.range, inPath.data(), inPath.size());
+        }
+        
+        auto* config = Config::GetSingleton();
+        if (PenetrationEngine::GetSingleton()->Tag(targetArrow, config->penetratingArrow.maxTargets, config->penetratingArrow.damageFalloff,
+                                                   inPath.data(), predicted)) {
+            SKSE::log::info("PenetratingArrow: Arrow tagged to pass through up to {} actors, {} predicted along the flight path",
+                            config->penetratingArrow.maxTargets, predicted);
+        }
         
         SKSE::log::info("PenetratingArrow: Successfully modified arrow for penetrating behavior (power: {:.2f}, speedMult: {:.2f})", 
                        projData.power, projData.speedMult);
     } else {
+        Metrics::GetSingleton()->Increment(Metrics::Counter::PenetratingMisses);
         SKSE::log::warn("PenetratingArrow: Could not find player arrow to modify");
     }
 }
 
 void PenetratingArrowHandler::StartCharging()
 {
-    currentState = PenetratingArrowState::Charging;
-    chargingStartTime = std::chrono::steady_clock::now();
-    
-    auto* config = Config::GetSingleton();
-    SKSE::log::info("PenetratingArrow: Started charging for {} seconds", config->penetratingArrow.chargeTime);
-    // RE::DebugNotification("Penetrating Arrow: Charging...");
+    logic.StartCharging();
 }
 
 void PenetratingArrowHandler::ResetState()
 {
-    if (currentState != PenetratingArrowState::Inactive && currentState != PenetratingArrowState::Cooldown) {
-        SKSE::log::debug("PenetratingArrow: Resetting state to inactive");
-    }
-    currentState = PenetratingArrowState::Inactive;
-}
-
-void PenetratingArrowHandler::RegisterAnimationEventHandler()
-{
-    static bool registered = false;
-    if (registered) {
-        SKSE::log::debug("PenetratingArrow: Animation event handler already registered");
-        return; // Already registered
-    }
-    
-    auto* player = RE::PlayerCharacter::GetSingleton();
-    if (!player) {
-        SKSE::log::warn("PenetratingArrow: Player not available for animation event registration");
-        return;
-    }
-    
-    RE::BSTSmartPointer<RE::BSAnimationGraphManager> animationGraphManager;
-    if (player->GetAnimationGraphManager(animationGraphManager) && animationGraphManager) {
-        if (!animationGraphManager->graphs.empty()) {
-            // Register this PenetratingArrowHandler as an animation event sink
-            animationGraphManager->graphs.front()->GetEventSource<RE::BSAnimationGraphEvent>()->AddEventSink(this);
-            SKSE::log::info("PenetratingArrow: Animation event handler registered successfully");
-            registered = true;
-        } else {
-            SKSE::log::error("PenetratingArrow: No animation graphs available");
-        }
-    } else {
-        SKSE::log::error("PenetratingArrow: Failed to get AnimationGraphManager");
-    }
+    logic.ResetState();
 }
 
 // State query methods
 bool PenetratingArrowHandler::IsCharged() const
 {
-    return currentState == PenetratingArrowState::Charged;
+    return logic.IsCharged();
 }
 
 bool PenetratingArrowHandler::IsCharging() const
 {
-    return currentState == PenetratingArrowState::Charging;
+    return logic.IsCharging();
 }
 
 bool PenetratingArrowHandler::IsOnCooldown() const
 {
-    return currentState == PenetratingArrowState::Cooldown;
+    return logic.IsOnCooldown();
 }
 
 PenetratingArrowState PenetratingArrowHandler::GetCurrentState() const
 {
-    return currentState;
+    return logic.GetState();
 }
 
 float PenetratingArrowHandler::GetChargingProgress() const
 {
-    if (currentState != PenetratingArrowState::Charging) {
-        return 0.0f;
-    }
-    
-    auto* config = Config::GetSingleton();
-    auto now = std::chrono::steady_clock::now();
-    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - chargingStartTime).count() / 1000.0f;
-    float progress = elapsed / config->penetratingArrow.chargeTime;
-    return std::min(1.0f, progress);
+    return logic.GetChargingProgress();
 }
 
 float PenetratingArrowHandler::GetRemainingCooldownTime() const
 {
-    if (currentState != PenetratingArrowState::Cooldown) {
-        return 0.0f;
-    }
-    
-    auto* config = Config::GetSingleton();
-    auto now = std::chrono::steady_clock::now();
-    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - cooldownStartTime).count() / 1000.0f;
-    float remaining = config->penetratingArrow.cooldownDuration - elapsed;
-    return std::max(0.0f, remaining);
+    return logic.GetRemainingCooldownTime();
 }
 
 // Utility methods
 bool PenetratingArrowHandler::CanStartCharging() const
 {
-    auto* player = RE::PlayerCharacter::GetSingleton();
-    if (!player) {
-        return false;
-    }
-
-    // Check if player is in a valid state
-    if (player->IsInKillMove() || player->IsDead()) {
-        return false;
-    }
-
-    // Check if UI is open
-    auto* ui = RE::UI::GetSingleton();
-    if (ui && ui->GameIsPaused()) {
-        return false;
-    }
-
-    // Check if a valid bow is equipped
-    auto* equippedWeapon = player->GetEquippedObject(false);
-    auto* weapon = equippedWeapon ? equippedWeapon->As<RE::TESObjectWEAP>() : nullptr;
-    
-    if (!IsValidBow(weapon)) {
-        return false;
-    }
-
-    // Check if perk is required and if player has it
-    auto* config = Config::GetSingleton();
-    if (config->enablePerks) {
-        if (!Config::HasPenetratePerk()) {
-            SKSE::log::debug("PenetratingArrow: Player does not have required perk");
-            return false;
-        }
-    }
-
-    // Check if multishot is active - cannot fire penetrating arrow with multishot
-    auto* multishotHandler = MultishotHandler::GetSingleton();
-    if (multishotHandler->IsInReadyState()) {
-        SKSE::log::debug("PenetratingArrow: Cannot start charging - multishot is in ready state");
-        return false;
-    }
-
-    // Can only start charging if currently inactive
-    return currentState == PenetratingArrowState::Inactive;
+    return logic.CanStartCharging();
 }
 
 bool PenetratingArrowHandler::IsValidBow(RE::TESObjectWEAP* weapon) const
@@ -492,4 +309,17 @@ bool PenetratingArrowHandler::IsValidBow(RE::TESObjectWEAP* weapon) const
     return weapon->GetWeaponType() == RE::WEAPON_TYPE::kBow;
 }
 
+void PenetratingArrowHandler::Save(TechniqueRecord::Record& record) const
+{
+    logic.Save(record);
+}
 
+void PenetratingArrowHandler::Load(const TechniqueRecord::Entry& entry)
+{
+    logic.Load(entry);
+}
+
+void PenetratingArrowHandler::Revert()
+{
+    logic.Revert();
+}
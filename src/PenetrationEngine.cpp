@@ -0,0 +1,205 @@
+#include "PenetrationEngine.h"
+#include <RE/M/MissileProjectile.h>
+#include <algorithm>
+#include <cmath>
+
+PenetrationEngine* PenetrationEngine::GetSingleton()
+{
+    static PenetrationEngine singleton;
+    return &singleton;
+}
+
+void PenetrationEngine::Install()
+{
+    REL::Relocation<std::uintptr_t> vtbl{ RE::VTABLE_ArrowProjectile[0] };
+    _AddImpact = vtbl.write_vfunc(REL::Relocate<std::size_t>(0xBD, 0xBD, 0xBE), AddImpact);
+    SKSE::log::info("PenetrationEngine: ArrowProjectile::AddImpact hook installed");
+}
+
+bool PenetrationEngine::TaggedArrow::HasHit(RE::FormID a_formID) const
+{
+    for (std::uint8_t i = 0; i < hitCount && i < kMaxHitsPerArrow; ++i) {
+        if (hitActors[i] == a_formID) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool PenetrationEngine::TaggedArrow::HasTargetsAhead() const
+{
+    if (inPathCount == 0) {
+        return true;
+    }
+    for (std::uint8_t i = 0; i < inPathCount; ++i) {
+        if (!HasHit(inPath[i])) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool PenetrationEngine::Tag(RE::Projectile* projectile, int maxTargets, float damageFalloff, const RE::FormID* inPath, std::size_t inPathCount)
+{
+    if (!projectile || maxTargets < 1) {
+        return false;
+    }
+
+    std::scoped_lock guard(lock);
+
+    ReclaimDeadLocked();
+
+    TaggedArrow* freeSlot = nullptr;
+    for (auto& arrow : arrows) {
+        if (!arrow.projectile) {
+            freeSlot = &arrow;
+            break;
+        }
+    }
+
+    if (!freeSlot) {
+        SKSE::log::warn("PenetrationEngine: All {} penetration slots in use, arrow not tagged", kMaxTaggedArrows);
+        return false;
+    }
+
+    freeSlot->projectile = projectile;
+    freeSlot->handle = RE::ProjectileHandle(projectile);
+    freeSlot->hitCount = 0;
+    freeSlot->inPathCount = static_cast<std::uint8_t>(inPath ? std::min<std::size_t>(inPathCount, kMaxHitsPerArrow) : 0);
+    std::copy_n(inPath, freeSlot->inPathCount, freeSlot->inPath.begin());
+    freeSlot->maxTargets = static_cast<std::uint8_t>(std::min(maxTargets, kMaxHitsPerArrow));
+    freeSlot->basePower = projectile->GetProjectileRuntimeData().power;
+    freeSlot->damageFalloff = damageFalloff;
+    published[freeSlot - arrows.data()].store(projectile, std::memory_order_relaxed);
+    taggedCount.fetch_add(1, std::memory_order_relaxed);
+
+    SKSE::log::debug("PenetrationEngine: Tagged arrow {:X} for up to {} targets, {} predicted", projectile->GetFormID(), maxTargets,
+                     freeSlot->inPathCount);
+    return true;
+}
+
+void PenetrationEngine::ReclaimDead()
+{
+    if (taggedCount.load(std::memory_order_relaxed) == 0) {
+        return;
+    }
+    std::scoped_lock guard(lock);
+    ReclaimDeadLocked();
+}
+
+void PenetrationEngine::ReclaimDeadLocked()
+{
+    for (auto& arrow : arrows) {
+        // The arrow was destroyed without a final impact (expired, despawned, cell unloaded)
+        if (arrow.projectile && !arrow.handle.get()) {
+            Release(arrow);
+        }
+    }
+}
+
+void PenetrationEngine::Clear()
+{
+    std::scoped_lock guard(lock);
+    for (auto& arrow : arrows) {
+        if (arrow.projectile) {
+            Release(arrow);
+        }
+    }
+}
+
+void PenetrationEngine::Release(TaggedArrow& arrow)
+{
+    published[&arrow - arrows.data()].store(nullptr, std::memory_order_relaxed);
+    arrow = TaggedArrow{};
+    taggedCount.fetch_sub(1, std::memory_order_relaxed);
+}
+
+bool PenetrationEngine::MayBeTagged(const RE::Projectile* projectile) const
+{
+    for (const auto& slot : published) {
+        if (slot.load(std::memory_order_relaxed) == projectile) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool PenetrationEngine::OnImpact(RE::Projectile* projectile, RE::TESObjectREFR* ref, bool& passThrough)
+{
+    passThrough = false;
+
+    std::scoped_lock guard(lock);
+
+    TaggedArrow* arrow = nullptr;
+    for (auto& candidate : arrows) {
+        if (candidate.projectile == projectile) {
+            arrow = &candidate;
+            break;
+        }
+    }
+    if (!arrow) {
+        return false;
+    }
+
+    // The address may have been reused by a new projectile after ours was destroyed
+    if (arrow->handle.get().get() != projectile) {
+        Release(*arrow);
+        return false;
+    }
+
+    auto* actor = ref ? ref->As<RE::Actor>() : nullptr;
+    if (!actor) {
+        // Hit the world - the arrow stops here as normal
+        Release(*arrow);
+        return false;
+    }
+
+    auto formID = actor->GetFormID();
+    if (arrow->HasHit(formID)) {
+        // Repeat contact while passing through the same body
+        return true;
+    }
+
+    auto& projData = projectile->GetProjectileRuntimeData();
+    projData.power = arrow->basePower * std::pow(arrow->damageFalloff, static_cast<float>(arrow->hitCount));
+    arrow->hitActors[arrow->hitCount++] = formID;
+
+    SKSE::log::debug("PenetrationEngine: Arrow {:X} hit {:X} ({}/{}), power {:.2f}", projectile->GetFormID(), formID,
+                     arrow->hitCount, arrow->maxTargets, projData.power);
+
+    // Nobody left in line means nothing to pass through to, so this actor is impaled
+    passThrough = arrow->hitCount < arrow->maxTargets && arrow->HasTargetsAhead();
+    if (!passThrough) {
+        Release(*arrow);
+    }
+    return false;
+}
+
+void PenetrationEngine::AddImpact(RE::Projectile* a_this, RE::TESObjectREFR* a_ref, const RE::NiPoint3& a_targetLoc, const RE::NiPoint3& a_velocity,
+                                  RE::hkpCollidable* a_collidable, std::int32_t a_arg6, std::uint32_t a_arg7)
+{
+    auto* engine = GetSingleton();
+
+    // Fast path for the vast majority of arrows: nothing tagged, or not this one
+    if (engine->taggedCount.load(std::memory_order_relaxed) == 0 || !engine->MayBeTagged(a_this)) {
+        return _AddImpact(a_this, a_ref, a_targetLoc, a_velocity, a_collidable, a_arg6, a_arg7);
+    }
+
+    bool passThrough = false;
+    if (engine->OnImpact(a_this, a_ref, passThrough)) {
+        return;
+    }
+
+    _AddImpact(a_this, a_ref, a_targetLoc, a_velocity, a_collidable, a_arg6, a_arg7);
+
+    if (passThrough) {
+        // Keep the arrow alive so it carries on to the next actor
+        auto& projData = a_this->GetProjectileRuntimeData();
+        projData.flags.reset(RE::Projectile::Flags::kDestroyAfterHit);
+
+        auto* missile = a_this->As<RE::MissileProjectile>();
+        if (missile) {
+            missile->GetMissileRuntimeData().impactResult = RE::ImpactResult::kImpale;
+        }
+    }
+}
@@ -0,0 +1,55 @@
+#include "PlayerGraphSink.h"
+#include <SKSE/SKSE.h>
+#include <utility>
+
+PlayerGraphSink::PlayerGraphSink(Sink* sink, const char* owner) :
+    sink(sink), owner(owner)
+{
+}
+
+PlayerGraphSink::~PlayerGraphSink()
+{
+    // Statics are destroyed after the game has torn down its heap, so this
+    // detaches without calling into the game: the source is forgotten rather
+    // than left, and the graph reference is abandoned rather than released
+    sink.release();
+    graph = nullptr;
+}
+
+bool PlayerGraphSink::Refresh()
+{
+    auto* player = RE::PlayerCharacter::GetSingleton();
+    RE::BSTSmartPointer<RE::BSAnimationGraphManager> manager;
+    if (!player || !player->GetAnimationGraphManager(manager) || !manager || manager->graphs.empty()) {
+        // No graph right now (3D unloaded or being reset): let go of the old one
+        if (Detach()) {
+            SKSE::log::info("{}: Animation graph unloaded, event handler detached", owner);
+        }
+        return false;
+    }
+
+    auto* current = manager->graphs.front().get();
+    if (current == graph && sink.registered()) {
+        return true;
+    }
+
+    if (Detach()) {
+        SKSE::log::info("{}: Animation graph changed, moving the event handler", owner);
+    }
+    GraphRef::Acquire(current);
+    graph = current;
+    if (sink.Register(graph->GetEventSource<RE::BSAnimationGraphEvent>())) {
+        SKSE::log::info("{}: Animation event handler registered successfully", owner);
+    }
+    return sink.registered();
+}
+
+bool PlayerGraphSink::Detach()
+{
+    // The held reference keeps the old source alive until the sink has left it
+    bool left = sink.Unregister();
+    if (graph) {
+        GraphRef::Release(std::exchange(graph, nullptr));
+    }
+    return left;
+}
@@ -0,0 +1,130 @@
+#include "Serialization.h"
+#include "MultishotHandler.h"
+#include "PenetratingArrowHandler.h"
+#include "PenetrationEngine.h"
+#include "TechniqueRecord.h"
+
+namespace Serialization {
+    namespace {
+        // Records are large (fixed capacity) but only the used prefix is written or read
+        TechniqueRecord::Record scratch;
+
+        void WriteTechnique(SKSE::SerializationInterface* a_intfc, std::uint32_t type, const TechniqueRecord::Record& record)
+        {
+            if (!a_intfc->WriteRecord(type, TechniqueRecord::kVersion, &record, record.ByteSize())) {
+                SKSE::log::error("Serialization: Failed to write record {:08X}", type);
+            }
+        }
+
+        // Reads a record into scratch; returns false if it is unusable
+        bool ReadTechnique(SKSE::SerializationInterface* a_intfc, std::uint32_t type, std::uint32_t version, std::uint32_t length)
+        {
+            scratch.Clear();
+            if (version != TechniqueRecord::kVersion) {
+                SKSE::log::warn("Serialization: Record {:08X} has unknown version {}, skipping", type, version);
+                return false;
+            }
+
+            std::uint32_t storedCount = 0;
+            if (a_intfc->ReadRecordData(storedCount) != sizeof(storedCount)) {
+                SKSE::log::warn("Serialization: Record {:08X} is truncated, skipping", type);
+                return false;
+            }
+
+            // Anything past the readable entries is skipped by SKSE when the next record is opened
+            auto count = TechniqueRecord::ReadableCount(storedCount, length);
+            if (count < storedCount) {
+                SKSE::log::warn("Serialization: Record {:08X} holds {} entries, loading {}", type, storedCount, count);
+            }
+
+            auto bytes = static_cast<std::uint32_t>(count * sizeof(TechniqueRecord::Entry));
+            if (a_intfc->ReadRecordData(scratch.entries.data(), bytes) != bytes) {
+                SKSE::log::warn("Serialization: Record {:08X} is truncated, skipping", type);
+                return false;
+            }
+
+            // Drop actors whose form no longer exists in this load order
+            for (std::uint32_t i = 0; i < count; ++i) {
+                auto entry = scratch.entries[i];
+                if (a_intfc->ResolveFormID(entry.actor, entry.actor)) {
+                    scratch.entries[scratch.count++] = entry;
+                }
+            }
+            return true;
+        }
+
+        // Techniques only track the player for now; other actors' entries are carried by the format
+        const TechniqueRecord::Entry* FindPlayerEntry()
+        {
+            auto playerID = RE::PlayerCharacter::GetSingleton()->GetFormID();
+            for (std::uint32_t i = 0; i < scratch.count; ++i) {
+                if (scratch.entries[i].actor == playerID) {
+                    return &scratch.entries[i];
+                }
+            }
+            return nullptr;
+        }
+    }
+
+    void Install()
+    {
+        auto* serialization = SKSE::GetSerializationInterface();
+        if (!serialization) {
+            SKSE::log::error("Serialization: Interface unavailable, technique state will not be saved");
+            return;
+        }
+
+        serialization->SetUniqueID(TechniqueRecord::kUniqueID);
+        serialization->SetSaveCallback(OnSave);
+        serialization->SetLoadCallback(OnLoad);
+        serialization->SetRevertCallback(OnRevert);
+        SKSE::log::info("Serialization: Co-save callbacks registered");
+    }
+
+    void OnSave(SKSE::SerializationInterface* a_intfc)
+    {
+        scratch.Clear();
+        MultishotHandler::GetSingleton()->Save(scratch);
+        WriteTechnique(a_intfc, TechniqueRecord::kMultishotType, scratch);
+
+        scratch.Clear();
+        PenetratingArrowHandler::GetSingleton()->Save(scratch);
+        WriteTechnique(a_intfc, TechniqueRecord::kPenetratingArrowType, scratch);
+    }
+
+    void OnLoad(SKSE::SerializationInterface* a_intfc)
+    {
+        std::uint32_t type = 0;
+        std::uint32_t version = 0;
+        std::uint32_t length = 0;
+        while (a_intfc->GetNextRecordInfo(type, version, length)) {
+            switch (type) {
+            case TechniqueRecord::kMultishotType:
+                if (ReadTechnique(a_intfc, type, version, length)) {
+                    if (auto* entry = FindPlayerEntry()) {
+                        MultishotHandler::GetSingleton()->Load(*entry);
+                    }
+                }
+                break;
+            case TechniqueRecord::kPenetratingArrowType:
+                if (ReadTechnique(a_intfc, type, version, length)) {
+                    if (auto* entry = FindPlayerEntry()) {
+                        PenetratingArrowHandler::GetSingleton()->Load(*entry);
+                    }
+                }
+                break;
+            default:
+                SKSE::log::warn("Serialization: Unknown record type {:08X}", type);
+                break;
+            }
+        }
+    }
+
+    void OnRevert(SKSE::SerializationInterface*)
+    {
+        MultishotHandler::GetSingleton()->Revert();
+        PenetratingArrowHandler::GetSingleton()->Revert();
+        // Runs before every load too, so no slot outlives the world its arrow was in
+        PenetrationEngine::GetSingleton()->Clear();
+    }
+}
@@ -0,0 +1,232 @@
+#include "SkyrimFacade.h"
+#include "ArcheryContext.h"
+#include "BowDrawTracker.h"
+#include "Config.h"
+#include "GameClock.h"
+#include "GameQueries.h"
+#include "Metrics.h"
+#include "MultishotHandler.h"
+#include "NotificationQueue.h"
+#include "PenetratingArrowHandler.h"
+#include "TaskQueue.h"
+#include "Trace.h"
+#include <chrono>
+#include <format>
+#include <string_view>
+
+namespace {
+    // Runs a task on the main thread next frame, through the SKSE task
+    // interface only if the plugin's queue is full
+    template <class F>
+    void Defer(F&& task)
+    {
+        if (TaskQueue::GetSingleton()->Push(std::forward<F>(task))) {
+            return;
+        }
+
+        auto* taskInterface = SKSE::GetTaskInterface();
+        if (!taskInterface) {
+            Metrics::GetSingleton()->Increment(Metrics::Counter::TasksDropped);
+            return;
+        }
+        taskInterface->AddTask(std::forward<F>(task));
+    }
+
+    using Channel = NotificationQueue::Channel;
+
+    // Formats into a fixed buffer and leaves coalescing and throttling to the
+    // queue; FrameHook posts whatever is due to the UI thread
+    template <class... Args>
+    void Notify(Channel channel, std::format_string<Args...> fmt, Args&&... args)
+    {
+        char text[NotificationQueue::kMaxLength];
+        auto result = std::format_to_n(text, std::ssize(text), fmt, std::forward<Args>(args)...);
+        NotificationQueue::GetSingleton()->Post(channel, std::string_view(text, static_cast<std::size_t>(result.out - text)));
+    }
+
+    // Waits out a short delay so the game has created the arrow, then converts
+    // it; requeues itself each frame instead of sleeping on the main thread
+    struct PenetratingLaunch {
+        RE::PlayerCharacter* player;
+        RE::TESObjectWEAP* weapon;
+        RE::TESAmmo* ammo;
+        GameClock::RealTime due;
+
+        void operator()() const
+        {
+            if (GameClock::GetSingleton()->RealNow() < due) {
+                Defer(*this);
+                return;
+            }
+            Trace::Zone zone("Task: Penetrating arrow launch");
+            PenetratingArrowHandler::GetSingleton()->LaunchPenetratingArrow(player, weapon, ammo);
+        }
+    };
+}
+
+SkyrimFacade* SkyrimFacade::GetSingleton()
+{
+    static SkyrimFacade singleton;
+    return &singleton;
+}
+
+double SkyrimFacade::GameTime() const
+{
+    return GameClock::GetSingleton()->GameTime();
+}
+
+Game::Shooter SkyrimFacade::GetShooter() const
+{
+    const auto& context = ArcheryContextService::Get();
+
+    Game::Shooter shooter;
+    shooter.present = context.player != nullptr;
+    shooter.incapacitated = context.inKillMove || context.isDead;
+    shooter.paused = context.gamePaused;
+    shooter.hasBow = context.hasBow;
+    shooter.hasAmmo = context.weapon && context.ammo;
+    return shooter;
+}
+
+std::uint32_t SkyrimFacade::PlayerID() const
+{
+    auto* player = RE::PlayerCharacter::GetSingleton();
+    return player ? player->GetFormID() : 0;
+}
+
+bool SkyrimFacade::MeetsPerkRequirement(Game::Technique technique) const
+{
+    if (!Config::GetSingleton()->enablePerks) {
+        return true;
+    }
+
+    bool multishot = technique == Game::Technique::Multishot;
+    if (multishot ? Config::HasMultishotPerk() : Config::HasPenetratePerk()) {
+        return true;
+    }
+    SKSE::log::debug("{}: Player does not have required perk", multishot ? "Multishot" : "PenetratingArrow");
+    return false;
+}
+
+int SkyrimFacade::AmmoCount() const
+{
+    const auto& context = ArcheryContextService::Get();
+    auto* player = context.player;
+    auto* ammo = context.ammo;
+    if (!player || !ammo) {
+        return 0;
+    }
+
+    // Sums the ammo's change entry and base container count directly instead of
+    // building GetInventory's std::map, since this runs on every Multishot release
+    auto baseCount = [player, ammo] {
+        auto* container = player->GetContainer();
+        return container ? container->CountObjectsInContainer(ammo) : 0;
+    };
+    auto* changes = player->GetInventoryChanges();
+    if (!changes || !changes->entryList) {
+        return baseCount();
+    }
+    return GameQueries::CountItem(*changes->entryList, ammo, baseCount);
+}
+
+bool SkyrimFacade::IsDrawTracked() const
+{
+    return BowDrawTracker::GetSingleton()->IsActive();
+}
+
+bool SkyrimFacade::IsDrawing() const
+{
+    return BowDrawTracker::GetSingleton()->IsDrawing();
+}
+
+void SkyrimFacade::LaunchVolley(int arrowCount, int additionalArrows)
+{
+    const auto& context = ArcheryContextService::Get();
+    auto* player = context.player;
+    auto* weapon = context.weapon;
+    auto* ammo = context.ammo;
+
+    // Called from the arrowRelease event, so the latency is measured from here
+    auto released = Metrics::Clock::now();
+
+    // Delay multishot launch to let vanilla arrow launch completely first
+    Defer([player, weapon, ammo, arrowCount, additionalArrows, released]() {
+        Trace::Zone zone("Task: Multishot volley");
+        MultishotHandler::GetSingleton()->LaunchMultishotArrows(player, weapon, ammo, arrowCount, additionalArrows);
+        Metrics::GetSingleton()->RecordSince(Metrics::Stage::ReleaseToLaunch, released);
+    });
+}
+
+void SkyrimFacade::LaunchPenetratingArrow()
+{
+    const auto& context = ArcheryContextService::Get();
+    auto* player = context.player;
+    auto* weapon = context.weapon;
+    auto* ammo = context.ammo;
+
+    // Add a very small delay to let the game create the arrow first
+    auto due = GameClock::GetSingleton()->RealNow() + std::chrono::milliseconds(50);
+    Defer(PenetratingLaunch{ player, weapon, ammo, due });
+}
+
+void SkyrimFacade::Report(Game::Event event, float value)
+{
+    using Game::Event;
+
+    switch (event) {
+    case Event::MultishotReady:
+        SKSE::log::info("Multishot ready state activated for {} seconds", value);
+        Notify(Channel::Multishot, "Multishot: READY");
+        break;
+    case Event::MultishotAlreadyReady:
+        SKSE::log::info("Multishot already in ready state");
+        Notify(Channel::Multishot, "Multishot: Already READY");
+        break;
+    case Event::MultishotOnCooldown:
+        SKSE::log::info("Multishot on cooldown, {} seconds remaining", value);
+        Notify(Channel::Multishot, "Multishot: Cooldown ({:.0f}s)", value);
+        break;
+    case Event::MultishotTriggered:
+        SKSE::log::info("Multishot triggered! Starting cooldown for {} seconds", value);
+        Notify(Channel::Multishot, "Multishot: Cooldown ({:.0f}s)", value);
+        break;
+    case Event::MultishotInsufficientAmmo:
+        SKSE::log::info("Insufficient ammo for multishot");
+        Notify(Channel::Multishot, "Multishot: Insufficient ammo");
+        break;
+    case Event::MultishotExpired:
+        SKSE::log::info("Multishot ready window expired");
+        Notify(Channel::Multishot, "Multishot: Expired");
+        break;
+    case Event::MultishotCooldownFinished:
+        SKSE::log::info("Multishot cooldown finished");
+        Notify(Channel::Multishot, "Multishot: Ready to activate");
+        break;
+    case Event::MultishotRestored:
+        SKSE::log::info("Multishot state restored from save ({:.1f}s remaining)", value);
+        break;
+    case Event::PenetratingCharging:
+        SKSE::log::info("PenetratingArrow: Started charging for {} seconds", value);
+        break;
+    case Event::PenetratingCharged:
+        SKSE::log::info("PenetratingArrow: Arrow fully charged!");
+        break;
+    case Event::PenetratingFired:
+        SKSE::log::info("PenetratingArrow: Penetrating shot fired! Starting cooldown for {} seconds", value);
+        Notify(Channel::PenetratingArrow, "Penetrating Arrow: Cooldown ({:.0f}s)", value);
+        break;
+    case Event::PenetratingDrawLost:
+        SKSE::log::info("PenetratingArrow: No bow draw events for {:.2f}s - player stopped drawing, resetting", value);
+        break;
+    case Event::PenetratingBlockedByMultishot:
+        SKSE::log::info("PenetratingArrow: Multishot activated - resetting penetrating arrow state");
+        break;
+    case Event::PenetratingCooldownFinished:
+        SKSE::log::info("PenetratingArrow: Cooldown finished");
+        break;
+    case Event::PenetratingRestored:
+        SKSE::log::info("PenetratingArrow: Cooldown restored from save ({:.1f}s remaining)", value);
+        break;
+    }
+}
@@ -0,0 +1,87 @@
+#include "SpreadPatterns.h"
+#include "FastTrig.h"
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+
+namespace SpreadPatterns {
+    namespace {
+        struct PatternName {
+            Pattern pattern;
+            std::string_view name;
+        };
+
+        constexpr PatternName kPatternNames[] = {
+            { Pattern::Fan, "fan" },
+            { Pattern::Vertical, "vertical" },
+            { Pattern::Cone, "cone" },
+            { Pattern::Ring, "ring" },
+            { Pattern::Cross, "cross" },
+        };
+    }
+
+    AimBasis MakeAimBasis(float pitch, float yaw)
+    {
+        float sinPitch, cosPitch, sinYaw, cosYaw;
+        FastTrig::SinCos(pitch, sinPitch, cosPitch);
+        FastTrig::SinCos(yaw, sinYaw, cosYaw);
+
+        // up = right x forward, so the frame stays orthonormal at any pitch
+        return {
+            { cosYaw, -sinYaw, 0.0f },
+            { cosPitch * sinYaw, cosPitch * cosYaw, -sinPitch },
+            { sinPitch * sinYaw, sinPitch * cosYaw, cosPitch },
+        };
+    }
+
+    void ApplyOffset(const AimBasis& basis, float tanSpread, Offset offset, float (&direction)[3])
+    {
+        float r = offset.right * tanSpread;
+        float u = offset.up * tanSpread;
+
+        float lengthSq = 0.0f;
+        for (int axis = 0; axis < 3; ++axis) {
+            direction[axis] = basis.forward[axis] + r * basis.right[axis] + u * basis.up[axis];
+            lengthSq += direction[axis] * direction[axis];
+        }
+
+        float invLength = 1.0f / std::sqrt(lengthSq);
+        for (float& component : direction) {
+            component *= invLength;
+        }
+    }
+
+    void DirectionToAngles(const float (&direction)[3], float& pitch, float& yaw)
+    {
+        // direction is unit length, so the plain sqrt cannot overflow the way hypot guards against
+        float horizontal = std::sqrt(direction[0] * direction[0] + direction[1] * direction[1]);
+        pitch = -FastTrig::Atan2(direction[2], horizontal);
+        yaw = FastTrig::Atan2(direction[0], direction[1]);
+    }
+
+    Pattern FromString(std::string_view name, Pattern fallback)
+    {
+        auto matches = [name](std::string_view candidate) {
+            return std::ranges::equal(name, candidate, [](char a, char b) {
+                return std::tolower(static_cast<unsigned char>(a)) == b;
+            });
+        };
+
+        for (const auto& entry : kPatternNames) {
+            if (matches(entry.name)) {
+                return entry.pattern;
+            }
+        }
+        return fallback;
+    }
+
+    std::string_view ToString(Pattern pattern)
+    {
+        for (const auto& entry : kPatternNames) {
+            if (entry.pattern == pattern) {
+                return entry.name;
+            }
+        }
+        return "unknown";
+    }
+}
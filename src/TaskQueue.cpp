@@ -0,0 +1,81 @@
+#include "TaskQueue.h"
+#include "Metrics.h"
+#include "Trace.h"
+
+static_assert((TaskQueue::kCapacity & (TaskQueue::kCapacity - 1)) == 0, "kCapacity must be a power of two");
+
+TaskQueue* TaskQueue::GetSingleton()
+{
+    static TaskQueue singleton;
+    return &singleton;
+}
+
+TaskQueue::TaskQueue()
+{
+    for (std::size_t i = 0; i < kCapacity; ++i) {
+        slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+TaskQueue::~TaskQueue()
+{
+    auto pos = dequeuePos.load(std::memory_order_relaxed);
+    for (;; ++pos) {
+        auto& slot = slots[pos & (kCapacity - 1)];
+        if (slot.sequence.load(std::memory_order_acquire) != pos + 1) {
+            break;
+        }
+        slot.invoke(slot.storage, false);
+    }
+}
+
+void TaskQueue::OnPushed(std::size_t enqueued)
+{
+    Metrics::GetSingleton()->Increment(Metrics::Counter::TasksQueued);
+
+    // Approximate under contention, which is all a high-water mark needs
+    auto depth = enqueued - dequeuePos.load(std::memory_order_relaxed);
+    auto peak = peakDepth.load(std::memory_order_relaxed);
+    while (depth > peak && !peakDepth.compare_exchange_weak(peak, depth, std::memory_order_relaxed)) {
+    }
+}
+
+void TaskQueue::OnBoxed()
+{
+    Metrics::GetSingleton()->Increment(Metrics::Counter::TasksBoxed);
+}
+
+std::size_t TaskQueue::Drain()
+{
+    auto pos = dequeuePos.load(std::memory_order_relaxed);
+    auto end = enqueuePos.load(std::memory_order_acquire);
+    if (pos == end) {
+        return 0;
+    }
+
+    Trace::Zone zone("TaskQueue::Drain");
+    auto start = Metrics::Clock::now();
+    std::size_t ran = 0;
+    for (; pos != end; ++pos) {
+        auto& slot = slots[pos & (kCapacity - 1)];
+        // A producer that claimed this slot may not have finished writing it;
+        // it and everything after it run next frame
+        if (slot.sequence.load(std::memory_order_acquire) != pos + 1) {
+            break;
+        }
+        slot.invoke(slot.storage, true);
+        slot.sequence.store(pos + kCapacity, std::memory_order_release);
+        dequeuePos.store(pos + 1, std::memory_order_relaxed);
+        ++ran;
+    }
+
+    Metrics::GetSingleton()->RecordSince(Metrics::Stage::TaskDrain, start);
+    return ran;
+}
+
+std::size_t TaskQueue::Depth() const
+{
+    auto dequeued = dequeuePos.load(std::memory_order_relaxed);
+    auto enqueued = enqueuePos.load(std::memory_order_relaxed);
+    return enqueued > dequeued ? enqueued - dequeued : 0;
+}
@@ -0,0 +1,474 @@
+#include "TechniqueLogic.h"
+#include "Ballistics.h"
+#include "FastTrig.h"
+#include <algorithm>
+#include <cmath>
+
+// ============================================
+// MultishotLogic
+// ============================================
+MultishotLogic::MultishotLogic(Game::Facade& game, const MultishotConfig& config) :
+    game(game),
+    config(config)
+{
+}
+
+float MultishotLogic::Since(double stamp) const
+{
+    return static_cast<float>(game.GameTime() - stamp);
+}
+
+bool MultishotLogic::TryActivate()
+{
+    if (!CanActivate()) {
+        return false;
+    }
+    Activate();
+    return IsReady();
+}
+
+bool MultishotLogic::CanActivate()
+{
+    // Player alive, not in a kill move, game running and a bow equipped
+    if (!game.GetShooter().CanShoot()) {
+        return false;
+    }
+
+    if (!game.MeetsPerkRequirement(Game::Technique::Multishot)) {
+        return false;
+    }
+
+    // Update state to check for transitions
+    Update();
+
+    // Can only activate if currently inactive
+    return state == MultishotState::Inactive;
+}
+
+void MultishotLogic::Activate()
+{
+    // Update state before checking
+    Update();
+
+    if (state == MultishotState::Ready) {
+        game.Report(Game::Event::MultishotAlreadyReady);
+        return;
+    }
+    if (state == MultishotState::Cooldown) {
+        game.Report(Game::Event::MultishotOnCooldown, GetRemainingCooldownTime());
+        return;
+    }
+
+    state = MultishotState::Ready;
+    readyStateStartTime = game.GameTime();
+    game.Report(Game::Event::MultishotReady, config.readyWindowDuration);
+}
+
+bool MultishotLogic::OnArrowRelease()
+{
+    // Update state to handle any transitions
+    Update();
+
+    if (state != MultishotState::Ready) {
+        return false; // Normal shot, do nothing
+    }
+
+    auto shooter = game.GetShooter();
+    if (!shooter.present) {
+        return false;
+    }
+
+    int arrowCount = config.arrowCount;
+    if (arrowCount < 2) {
+        return false;
+    }
+
+    // The vanilla arrow has already been fired, so we fire (arrowCount - 1) additional arrows
+    int additionalArrows = arrowCount - 1;
+    if (game.AmmoCount() < additionalArrows) {
+        game.Report(Game::Event::MultishotInsufficientAmmo);
+        return false;
+    }
+
+    if (!shooter.hasAmmo) {
+        return false;
+    }
+
+    // Transition to cooldown state
+    state = MultishotState::Cooldown;
+    cooldownStartTime = game.GameTime();
+    game.Report(Game::Event::MultishotTriggered, config.cooldownDuration);
+
+    game.LaunchVolley(arrowCount, additionalArrows);
+    return true;
+}
+
+void MultishotLogic::Update()
+{
+    if (state == MultishotState::Ready) {
+        // Check if ready window has expired
+        if (Since(readyStateStartTime) >= config.readyWindowDuration) {
+            state = MultishotState::Inactive;
+            game.Report(Game::Event::MultishotExpired);
+        }
+    } else if (state == MultishotState::Cooldown) {
+        // Check if cooldown has finished
+        if (Since(cooldownStartTime) >= config.cooldownDuration) {
+            state = MultishotState::Inactive;
+            game.Report(Game::Event::MultishotCooldownFinished);
+        }
+    }
+}
+
+float MultishotLogic::GetRemainingReadyTime() const
+{
+    if (state != MultishotState::Ready) {
+        return 0.0f;
+    }
+    return std::max(0.0f, config.readyWindowDuration - Since(readyStateStartTime));
+}
+
+float MultishotLogic::GetRemainingCooldownTime() const
+{
+    if (state != MultishotState::Cooldown) {
+        return 0.0f;
+    }
+    return std::max(0.0f, config.cooldownDuration - Since(cooldownStartTime));
+}
+
+void MultishotLogic::Save(TechniqueRecord::Record& record) const
+{
+    TechniqueRecord::Entry entry;
+    entry.actor = game.PlayerID();
+    entry.state = static_cast<std::uint8_t>(state);
+    if (state == MultishotState::Ready) {
+        entry.remaining = GetRemainingReadyTime();
+    } else if (state == MultishotState::Cooldown) {
+        entry.remaining = GetRemainingCooldownTime();
+    } else {
+        return;
+    }
+    record.Add(entry);
+}
+
+void MultishotLogic::Load(const TechniqueRecord::Entry& entry)
+{
+    auto now = game.GameTime();
+    float remaining = 0.0f;
+    auto startedAgo = [&](float duration) {
+        remaining = TechniqueRecord::ClampRemaining(entry.remaining, duration);
+        return now - (duration - remaining);
+    };
+
+    switch (static_cast<MultishotState>(entry.state)) {
+    case MultishotState::Ready:
+        state = MultishotState::Ready;
+        readyStateStartTime = startedAgo(config.readyWindowDuration);
+        break;
+    case MultishotState::Cooldown:
+        state = MultishotState::Cooldown;
+        cooldownStartTime = startedAgo(config.cooldownDuration);
+        break;
+    default:
+        state = MultishotState::Inactive;
+        return;
+    }
+    game.Report(Game::Event::MultishotRestored, remaining);
+}
+
+void MultishotLogic::Revert()
+{
+    state = MultishotState::Inactive;
+}
+
+// ============================================
+// PenetratingLogic
+// ============================================
+PenetratingLogic::PenetratingLogic(Game::Facade& game, const PenetratingArrowConfig& config, const MultishotLogic& multishot) :
+    game(game),
+    config(config),
+    multishot(multishot)
+{
+}
+
+float PenetratingLogic::Since(double stamp) const
+{
+    return static_cast<float>(game.GameTime() - stamp);
+}
+
+void PenetratingLogic::Update()
+{
+    UpdateBowDrawState();
+    CheckForStateTransitions();
+}
+
+void PenetratingLogic::UpdateBowDrawState()
+{
+    auto shooter = game.GetShooter();
+    if (!shooter.present) {
+        return;
+    }
+
+    // Check if player is in a valid state
+    if (shooter.incapacitated) {
+        ResetState();
+        return;
+    }
+
+    // Check if UI is open
+    if (shooter.paused) {
+        return; // Don't reset state, just pause tracking
+    }
+
+    // Check if a valid bow is equipped
+    if (!shooter.hasBow) {
+        ResetState();
+        return;
+    }
+
+    // Check if multishot is active - if so, reset penetrating arrow state
+    if (multishot.IsReady()) {
+        if (state == PenetratingArrowState::Charging || state == PenetratingArrowState::Charged) {
+            game.Report(Game::Event::PenetratingBlockedByMultishot);
+            ResetState();
+        }
+        return;
+    }
+
+    if (game.IsDrawTracked()) {
+        // Draw stop arrives from the tracker the frame it happens; only pick up a draw
+        // that was already held when charging became possible (e.g. cooldown ended)
+        if (state == PenetratingArrowState::Inactive && game.IsDrawing() && CanStartCharging()) {
+            StartCharging();
+        }
+        return;
+    }
+
+    // Without a tracker the draw is only seen through periodic animation events
+    if (state == PenetratingArrowState::Charging) {
+        auto timeSinceLastBowDraw = Since(lastBowDrawTime);
+        if (timeSinceLastBowDraw > kDrawEventTimeout) {
+            game.Report(Game::Event::PenetratingDrawLost, timeSinceLastBowDraw);
+            ResetState();
+        }
+    }
+}
+
+void PenetratingLogic::CheckForStateTransitions()
+{
+    if (state == PenetratingArrowState::Charging) {
+        // Check if charging time has elapsed (or, in VR, enough draw has been integrated)
+        bool complete = game.IsDrawTracked() ? chargeIntegrator.IsComplete() : Since(chargingStartTime) >= config.chargeTime;
+        if (complete) {
+            state = PenetratingArrowState::Charged;
+            game.Report(Game::Event::PenetratingCharged);
+        }
+    } else if (state == PenetratingArrowState::Cooldown) {
+        // Check if cooldown has finished
+        if (Since(cooldownStartTime) >= config.cooldownDuration) {
+            state = PenetratingArrowState::Inactive;
+            game.Report(Game::Event::PenetratingCooldownFinished);
+        }
+    }
+}
+
+void PenetratingLogic::OnBowDrawStart()
+{
+    // Always update the last bow draw time when we receive bow draw events
+    lastBowDrawTime = game.GameTime();
+
+    if (state == PenetratingArrowState::Inactive && CanStartCharging()) {
+        StartCharging();
+    }
+}
+
+void PenetratingLogic::OnBowDrawStop()
+{
+    // Player released the bow without firing
+    if (state == PenetratingArrowState::Charging) {
+        ResetState();
+    }
+}
+
+void PenetratingLogic::OnDrawFrame(float drawStrength, float delta)
+{
+    // Partial draws charge proportionally slower than a full draw
+    if (state == PenetratingArrowState::Charging) {
+        chargeIntegrator.Advance(drawStrength, delta, config.chargeTime);
+    }
+}
+
+void PenetratingLogic::OnArrowRelease()
+{
+    if (state != PenetratingArrowState::Charged) {
+        return; // Normal shot, do nothing
+    }
+
+    auto shooter = game.GetShooter();
+    if (!shooter.present) {
+        return;
+    }
+
+    if (!shooter.hasAmmo) {
+        ResetState();
+        return;
+    }
+
+    // Transition to cooldown state
+    state = PenetratingArrowState::Cooldown;
+    cooldownStartTime = game.GameTime();
+    game.Report(Game::Event::PenetratingFired, config.cooldownDuration);
+
+    game.LaunchPenetratingArrow();
+}
+
+void PenetratingLogic::StartCharging()
+{
+    state = PenetratingArrowState::Charging;
+    chargingStartTime = game.GameTime();
+    chargeIntegrator.Reset();
+    game.Report(Game::Event::PenetratingCharging, config.chargeTime);
+}
+
+void PenetratingLogic::ResetState()
+{
+    state = PenetratingArrowState::Inactive;
+}
+
+bool PenetratingLogic::CanStartCharging() const
+{
+    // Player alive, not in a kill move, game running and a bow equipped
+    if (!game.GetShooter().CanShoot()) {
+        return false;
+    }
+
+    if (!game.MeetsPerkRequirement(Game::Technique::PenetratingArrow)) {
+        return false;
+    }
+
+    // Cannot fire penetrating arrow with multishot
+    if (multishot.IsReady()) {
+        return false;
+    }
+
+    // Can only start charging if currently inactive
+    return state == PenetratingArrowState::Inactive;
+}
+
+float PenetratingLogic::GetChargingProgress() const
+{
+    if (state != PenetratingArrowState::Charging) {
+        return 0.0f;
+    }
+
+    if (game.IsDrawTracked()) {
+        return chargeIntegrator.Progress();
+    }
+    return std::min(1.0f, Since(chargingStartTime) / config.chargeTime);
+}
+
+float PenetratingLogic::GetRemainingCooldownTime() const
+{
+    if (state != PenetratingArrowState::Cooldown) {
+        return 0.0f;
+    }
+    return std::max(0.0f, config.cooldownDuration - Since(cooldownStartTime));
+}
+
+void PenetratingLogic::Save(TechniqueRecord::Record& record) const
+{
+    if (state != PenetratingArrowState::Cooldown) {
+        return;
+    }
+
+    TechniqueRecord::Entry entry;
+    entry.actor = game.PlayerID();
+    entry.state = static_cast<std::uint8_t>(state);
+    entry.remaining = GetRemainingCooldownTime();
+    record.Add(entry);
+}
+
+void PenetratingLogic::Load(const TechniqueRecord::Entry& entry)
+{
+    if (static_cast<PenetratingArrowState>(entry.state) != PenetratingArrowState::Cooldown) {
+        state = PenetratingArrowState::Inactive;
+        return;
+    }
+
+    float remaining = TechniqueRecord::ClampRemaining(entry.remaining, config.cooldownDuration);
+    state = PenetratingArrowState::Cooldown;
+    cooldownStartTime = game.GameTime() - (config.cooldownDuration - remaining);
+    game.Report(Game::Event::PenetratingRestored, remaining);
+}
+
+void PenetratingLogic::Revert()
+{
+    state = PenetratingArrowState::Inactive;
+    chargeIntegrator.Reset();
+}
+
+// ============================================
+// Volley layout
+// ============================================
+Volley::Layout Volley::Compute(const Input& input, const MultishotConfig& config)
+{
+    Layout layout;
+
+    // Slot 0 of every pattern is the vanilla arrow, the rest are ours
+    int arrowCount = std::clamp(input.arrowCount, 0, SpreadPatterns::kMaxArrows);
+    const auto& pattern = SpreadPatterns::GetTable(config.spreadPattern, arrowCount);
+    auto aimBasis = SpreadPatterns::MakeAimBasis(input.pitch, input.yaw);
+    float tanSpread = std::tan(FastTrig::ToRadians(config.spreadAngle));
+
+    for (int slot = 1; slot < arrowCount; ++slot) {
+        const auto& offset = pattern[slot];
+        int n = layout.count++;
+        layout.slots[n] = slot;
+        for (int axis = 0; axis < 3; ++axis) {
+            layout.origins[n][axis] = input.origin[axis] + input.cameraRight[axis] * (offset.right * kOriginSpacing) +
+                                      input.cameraUp[axis] * (offset.up * kOriginSpacing);
+        }
+
+        float direction[3];
+        SpreadPatterns::ApplyOffset(aimBasis, tanSpread, offset, direction);
+        SpreadPatterns::DirectionToAngles(direction, layout.pitch[n], layout.yaw[n]);
+    }
+
+    if (!config.convergence || layout.count == 0) {
+        return layout;
+    }
+    if (input.projectileSpeed <= 0.0f) {
+        layout.convergenceSkipped = true;
+        return layout;
+    }
+
+    // Pattern points are laid out on the plane through the aimed point, spacing units per pattern step
+    std::array<float, SpreadPatterns::kMaxArrows> dx{}, dy{}, dz{};
+    for (int n = 0; n < layout.count; ++n) {
+        const auto& offset = pattern[layout.slots[n]];
+        float* delta[3] = { &dx[n], &dy[n], &dz[n] };
+        for (int axis = 0; axis < 3; ++axis) {
+            float aimPoint = input.origin[axis] + aimBasis.forward[axis] * config.convergenceDistance;
+            float target = aimPoint + (aimBasis.right[axis] * offset.right + aimBasis.up[axis] * offset.up) * config.convergenceSpacing;
+            *delta[axis] = target - layout.origins[n][axis];
+        }
+    }
+
+    Ballistics::ConvergenceBatch batch{ dx.data(), dy.data(), dz.data(), layout.pitch.data(), layout.yaw.data(),
+                                        static_cast<std::size_t>(layout.count) };
+    layout.unreachable = Ballistics::Solve(batch, input.projectileSpeed, input.projectileGravity);
+    return layout;
+}
+
+Volley::Result Volley::Fire(const Input& input, const MultishotConfig& config, Launcher& launcher)
+{
+    Result result;
+    result.layout = Compute(input, config);
+    const auto& layout = result.layout;
+    for (int n = 0; n < layout.count; ++n) {
+        if (launcher.Launch(layout.slots[n], layout.origins[n], layout.pitch[n], layout.yaw[n])) {
+            ++result.launched;
+        }
+    }
+    return result;
+}
@@ -0,0 +1,36 @@
+#include "TechniqueRecord.h"
+#include <algorithm>
+#include <cmath>
+
+namespace TechniqueRecord {
+    bool Record::Add(const Entry& entry)
+    {
+        if (count >= kMaxEntries) {
+            return false;
+        }
+        entries[count++] = entry;
+        return true;
+    }
+
+    std::uint32_t Record::ByteSize() const
+    {
+        return static_cast<std::uint32_t>(sizeof(count) + sizeof(Entry) * count);
+    }
+
+    std::uint32_t ReadableCount(std::uint32_t storedCount, std::uint32_t recordLength)
+    {
+        if (recordLength < sizeof(std::uint32_t)) {
+            return 0;
+        }
+        auto available = (recordLength - static_cast<std::uint32_t>(sizeof(std::uint32_t))) / static_cast<std::uint32_t>(sizeof(Entry));
+        return std::min({ storedCount, available, static_cast<std::uint32_t>(kMaxEntries) });
+    }
+
+    float ClampRemaining(float remaining, float duration)
+    {
+        if (!std::isfinite(remaining)) {
+            return 0.0f;
+        }
+        return std::clamp(remaining, 0.0f, std::max(duration, 0.0f));
+    }
+}
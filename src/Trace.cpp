@@ -0,0 +1,174 @@
+#include "Trace.h"
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <vector>
+
+namespace Trace {
+    namespace {
+        // Marks an Instant() event in place of a duration
+        constexpr std::uint64_t kInstant = ~0ull;
+
+        struct Event {
+            const char* name = nullptr;
+            std::uint64_t start = 0;
+            std::uint64_t duration = 0;
+        };
+
+        // Written only by its thread; head is published after each event so a
+        // reader on another thread sees complete entries up to it
+        struct ThreadBuffer {
+            std::array<Event, kBufferEvents> events;
+            std::atomic<std::uint64_t> head{ 0 };
+            std::atomic<std::uint64_t> floor{ 0 };  // events before this were cleared
+            std::atomic<const char*> name{ nullptr };
+            std::uint32_t tid = 0;
+            ThreadBuffer* next = nullptr;
+        };
+
+        // Buffers are never freed, so an exited thread's events still export
+        std::atomic<ThreadBuffer*> buffers{ nullptr };
+        std::atomic<std::uint32_t> nextTid{ 1 };
+        std::atomic<std::uint64_t> origin{ 0 };
+
+        ThreadBuffer* GetThreadBuffer()
+        {
+            thread_local ThreadBuffer* buffer = nullptr;
+            if (!buffer) {
+                buffer = new ThreadBuffer();
+                buffer->tid = nextTid.fetch_add(1, std::memory_order_relaxed);
+                buffer->next = buffers.load(std::memory_order_relaxed);
+                while (!buffers.compare_exchange_weak(buffer->next, buffer, std::memory_order_release, std::memory_order_relaxed)) {
+                }
+            }
+            return buffer;
+        }
+
+        void Push(const Event& event)
+        {
+            auto* buffer = GetThreadBuffer();
+            auto head = buffer->head.load(std::memory_order_relaxed);
+            buffer->events[head % kBufferEvents] = event;
+            buffer->head.store(head + 1, std::memory_order_release);
+        }
+
+        struct Exported {
+            Event event;
+            std::uint32_t tid = 0;
+        };
+
+        // Copies a buffer's live events. Entries the writer may have overwritten
+        // while we copied are dropped by re-reading head afterwards.
+        void Collect(const ThreadBuffer& buffer, std::vector<Exported>& out)
+        {
+            auto head = buffer.head.load(std::memory_order_acquire);
+            auto first = std::max(buffer.floor.load(std::memory_order_relaxed), head > kBufferEvents ? head - kBufferEvents : 0);
+
+            std::size_t begin = out.size();
+            for (auto i = first; i < head; ++i) {
+                out.push_back({ buffer.events[i % kBufferEvents], buffer.tid });
+            }
+
+            auto after = buffer.head.load(std::memory_order_acquire);
+            if (after > kBufferEvents && after - kBufferEvents > first) {
+                auto overwritten = std::min<std::uint64_t>(after - kBufferEvents - first, out.size() - begin);
+                out.erase(out.begin() + static_cast<std::ptrdiff_t>(begin), out.begin() + static_cast<std::ptrdiff_t>(begin + overwritten));
+            }
+        }
+
+        void WriteName(std::FILE* file, const char* name)
+        {
+            std::fputc('"', file);
+            for (const char* c = name ? name : "?"; *c; ++c) {
+                if (*c == '"' || *c == '\\') {
+                    std::fputc('\\', file);
+                }
+                std::fputc(*c, file);
+            }
+            std::fputc('"', file);
+        }
+    }
+
+    namespace detail {
+        void Complete(const char* name, std::uint64_t start, std::uint64_t end)
+        {
+            Push({ name, start, end - start });
+        }
+    }
+
+    void SetEnabled(bool enabled)
+    {
+        std::uint64_t unset = 0;
+        origin.compare_exchange_strong(unset, detail::Now(), std::memory_order_relaxed);
+        detail::enabled.store(enabled, std::memory_order_relaxed);
+    }
+
+    void Instant(const char* name)
+    {
+        if (IsEnabled()) {
+            Push({ name, detail::Now(), kInstant });
+        }
+    }
+
+    void SetThreadName(const char* name)
+    {
+        GetThreadBuffer()->name.store(name, std::memory_order_relaxed);
+    }
+
+    long long Export(const std::filesystem::path& path)
+    {
+        std::vector<Exported> events;
+        for (auto* buffer = buffers.load(std::memory_order_acquire); buffer; buffer = buffer->next) {
+            Collect(*buffer, events);
+        }
+        std::sort(events.begin(), events.end(), [](const Exported& a, const Exported& b) { return a.event.start < b.event.start; });
+
+#ifdef _WIN32
+        std::FILE* file = _wfopen(path.c_str(), L"w");
+#else
+        std::FILE* file = std::fopen(path.c_str(), "w");
+#endif
+        if (!file) {
+            return -1;
+        }
+
+        std::fputs("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n", file);
+        bool first = true;
+        for (auto* buffer = buffers.load(std::memory_order_acquire); buffer; buffer = buffer->next) {
+            auto* name = buffer->name.load(std::memory_order_relaxed);
+            std::fprintf(file, "%s{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":", first ? "" : ",\n", buffer->tid);
+            if (name) {
+                WriteName(file, name);
+            } else {
+                std::fprintf(file, "\"Thread %u\"", buffer->tid);
+            }
+            std::fputs("}}", file);
+            first = false;
+        }
+
+        auto base = origin.load(std::memory_order_relaxed);
+        for (const auto& [event, tid] : events) {
+            double ts = static_cast<double>(event.start > base ? event.start - base : 0) / 1000.0;
+            std::fputs(first ? "{\"name\":" : ",\n{\"name\":", file);
+            WriteName(file, event.name);
+            if (event.duration == kInstant) {
+                std::fprintf(file, ",\"ph\":\"i\",\"s\":\"t\",\"ts\":%.3f,\"pid\":1,\"tid\":%u}", ts, tid);
+            } else {
+                std::fprintf(file, ",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%u}", ts, static_cast<double>(event.duration) / 1000.0, tid);
+            }
+            first = false;
+        }
+        std::fputs("\n]}\n", file);
+
+        bool ok = std::ferror(file) == 0;
+        ok = std::fclose(file) == 0 && ok;
+        return ok ? static_cast<long long>(events.size()) : -1;
+    }
+
+    void Clear()
+    {
+        for (auto* buffer = buffers.load(std::memory_order_acquire); buffer; buffer = buffer->next) {
+            buffer->floor.store(buffer->head.load(std::memory_order_acquire), std::memory_order_relaxed);
+        }
+    }
+}
@@ -0,0 +1,120 @@
+#include "catch2/catch_all.hpp"
+
+#include "ActorGrid.h"
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace {
+    // Actors scattered over a battlefield of the given half-extent
+    std::vector<ActorGrid::Entry> MakeBattle(std::size_t count, float halfExtent, std::uint32_t seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> position(-halfExtent, halfExtent);
+        std::uniform_real_distribution<float> height(-200.0f, 200.0f);
+
+        std::vector<ActorGrid::Entry> actors(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            actors[i] = { static_cast<std::uint32_t>(i + 1), position(rng), position(rng), height(rng), 48.0f };
+        }
+        return actors;
+    }
+
+    std::vector<std::uint32_t> Sorted(const std::uint32_t* ids, std::size_t count)
+    {
+        std::vector<std::uint32_t> sorted(ids, ids + count);
+        std::sort(sorted.begin(), sorted.end());
+        return sorted;
+    }
+}
+
+TEST_CASE("ActorGrid/CapsuleMatchesBruteForce")
+{
+    auto actors = MakeBattle(1000, 8000.0f, 7);
+    ActorGrid grid(512.0f);
+    grid.Update(actors);
+    REQUIRE(grid.Size() == actors.size());
+
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<float> position(-9000.0f, 9000.0f);
+    std::uniform_real_distribution<float> radius(0.0f, 300.0f);
+
+    std::vector<std::uint32_t> fromGrid(actors.size());
+    std::vector<std::uint32_t> fromBruteForce(actors.size());
+    for (int query = 0; query < 200; ++query) {
+        float a[3] = { position(rng), position(rng), 0.0f };
+        float b[3] = { position(rng), position(rng), 50.0f };
+        float r = radius(rng);
+
+        auto gridCount = grid.QueryCapsule(a, b, r, fromGrid.data(), fromGrid.size());
+        auto bruteCount = grid.QueryCapsuleBruteForce(a, b, r, fromBruteForce.data(), fromBruteForce.size());
+        CHECK(Sorted(fromGrid.data(), gridCount) == Sorted(fromBruteForce.data(), bruteCount));
+    }
+}
+
+TEST_CASE("ActorGrid/RayHitsActorInPath")
+{
+    std::vector<ActorGrid::Entry> actors = {
+        { 1, 0.0f, 1000.0f, 0.0f, 40.0f },
+        { 2, 0.0f, 3000.0f, 0.0f, 40.0f },
+        { 3, 500.0f, 1000.0f, 0.0f, 40.0f },
+        { 4, 0.0f, -1000.0f, 0.0f, 40.0f },
+    };
+    ActorGrid grid(512.0f);
+    grid.Update(actors);
+
+    float origin[3] = { 0.0f, 0.0f, 0.0f };
+    float direction[3] = { 0.0f, 1.0f, 0.0f };
+    std::uint32_t hits[4];
+    auto count = grid.QueryRay(origin, direction, 4000.0f, hits, 4);
+    CHECK(Sorted(hits, count) == std::vector<std::uint32_t>{ 1, 2 });
+
+    count = grid.QueryRay(origin, direction, 2000.0f, hits, 4);
+    CHECK(Sorted(hits, count) == std::vector<std::uint32_t>{ 1 });
+}
+
+TEST_CASE("ActorGrid/IncrementalUpdateTracksMovement")
+{
+    auto actors = MakeBattle(200, 4000.0f, 3);
+    ActorGrid grid(512.0f);
+    grid.Update(actors);
+
+    // Small steps keep most actors in their cell, so the re-sort stays cheap
+    for (auto& actor : actors) {
+        actor.x += 10.0f;
+    }
+    grid.Update(actors);
+    CHECK(grid.LastUpdateMoves() < actors.size());
+
+    float a[3] = { -5000.0f, -5000.0f, 0.0f };
+    float b[3] = { 5000.0f, 5000.0f, 0.0f };
+    std::vector<std::uint32_t> fromGrid(actors.size());
+    std::vector<std::uint32_t> fromBruteForce(actors.size());
+    auto gridCount = grid.QueryCapsule(a, b, 400.0f, fromGrid.data(), fromGrid.size());
+    auto bruteCount = grid.QueryCapsuleBruteForce(a, b, 400.0f, fromBruteForce.data(), fromBruteForce.size());
+    CHECK(Sorted(fromGrid.data(), gridCount) == Sorted(fromBruteForce.data(), bruteCount));
+}
+
+TEST_CASE("ActorGrid/Benchmark", "[!benchmark]")
+{
+    for (std::size_t count : { std::size_t{ 50 }, std::size_t{ 200 }, std::size_t{ 1000 } }) {
+        auto actors = MakeBattle(count, 8000.0f, 5);
+        ActorGrid grid(512.0f);
+        grid.Update(actors);
+
+        float origin[3] = { -6000.0f, 0.0f, 0.0f };
+        float end[3] = { 2000.0f, 800.0f, 0.0f };
+        std::vector<std::uint32_t> hits(count);
+
+        BENCHMARK("Update x" + std::to_string(count))
+        {
+            for (auto& actor : actors) {
+                actor.y += 1.0f;
+            }
+            grid.Update(actors);
+            return grid.Size();
+        };
+        BENCHMARK("Grid capsule x" + std::to_string(count)) { return grid.QueryCapsule(origin, end, 64.0f, hits.data(), hits.size()); };
+        BENCHMARK("Brute force capsule x" + std::to_string(count)) { return grid.QueryCapsuleBruteForce(origin, end, 64.0f, hits.data(), hits.size()); };
+    }
+}
@@ -0,0 +1,141 @@
+#include "catch2/catch_all.hpp"
+
+#include "Ballistics.h"
+#include <cmath>
+#include <vector>
+
+namespace {
+    constexpr float kArrowSpeed = 5400.0f;
+    constexpr float kArrowGravity = 0.35f * Ballistics::kGravityUnits;
+
+    struct Targets {
+        std::vector<float> dx, dy, dz, pitch, yaw;
+
+        explicit Targets(std::size_t count) : dx(count), dy(count), dz(count), pitch(count), yaw(count) {}
+
+        Ballistics::ConvergenceBatch Batch()
+        {
+            return { dx.data(), dy.data(), dz.data(), pitch.data(), yaw.data(), dx.size() };
+        }
+    };
+
+    // Deterministic spread of reachable targets around the shooter
+    Targets MakeTargets(std::size_t count)
+    {
+        Targets targets(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            float heading = static_cast<float>(i) * 0.61803f * 6.2831853f;
+            float distance = 300.0f + static_cast<float>((i * 7919) % 5700);
+            targets.dx[i] = std::sin(heading) * distance;
+            targets.dy[i] = std::cos(heading) * distance;
+            targets.dz[i] = static_cast<float>(static_cast<int>((i * 104729) % 1000) - 500);
+        }
+        return targets;
+    }
+
+    // Reference integrator: velocity Verlet in double precision, returns the height
+    // reached when the arrow crosses the target's horizontal distance
+    double IntegrateHeightAt(float pitch, float yaw, float speed, float gravity, double horizontal)
+    {
+        const double dt = 1.0e-4;
+        double vx = std::cos(-pitch) * std::sin(yaw) * speed;
+        double vy = std::cos(-pitch) * std::cos(yaw) * speed;
+        double vz = std::sin(-pitch) * speed;
+        double x = 0.0, y = 0.0, z = 0.0;
+
+        double prevH = 0.0, prevZ = 0.0;
+        for (int step = 0; step < 200000; ++step) {
+            x += vx * dt;
+            y += vy * dt;
+            z += vz * dt - 0.5 * gravity * dt * dt;
+            vz -= gravity * dt;
+
+            double h = std::sqrt(x * x + y * y);
+            if (h >= horizontal) {
+                double t = (horizontal - prevH) / (h - prevH);
+                return prevZ + (z - prevZ) * t;
+            }
+            prevH = h;
+            prevZ = z;
+        }
+        return NAN;
+    }
+}
+
+TEST_CASE("Ballistics/ScalarMatchesReferenceIntegrator")
+{
+    auto targets = MakeTargets(64);
+    auto batch = targets.Batch();
+    REQUIRE(Ballistics::SolveScalar(batch, kArrowSpeed, kArrowGravity) == 0);
+
+    for (std::size_t i = 0; i < batch.count; ++i) {
+        double horizontal = std::sqrt(targets.dx[i] * targets.dx[i] + targets.dy[i] * targets.dy[i]);
+        double height = IntegrateHeightAt(targets.pitch[i], targets.yaw[i], kArrowSpeed, kArrowGravity, horizontal);
+        CHECK(height == Catch::Approx(targets.dz[i]).margin(1.0));
+        CHECK(std::atan2(targets.dx[i], targets.dy[i]) == Catch::Approx(targets.yaw[i]));
+    }
+}
+
+TEST_CASE("Ballistics/SimdMatchesScalar")
+{
+    // Odd count exercises the SIMD tails
+    auto reference = MakeTargets(37);
+    Ballistics::SolveScalar(reference.Batch(), kArrowSpeed, kArrowGravity);
+
+    SECTION("SSE")
+    {
+        auto targets = MakeTargets(37);
+        Ballistics::SolveSSE(targets.Batch(), kArrowSpeed, kArrowGravity);
+        for (std::size_t i = 0; i < targets.pitch.size(); ++i) {
+            CHECK(targets.pitch[i] == Catch::Approx(reference.pitch[i]).margin(1.0e-5));
+            CHECK(targets.yaw[i] == Catch::Approx(reference.yaw[i]).margin(1.0e-5));
+        }
+    }
+    SECTION("AVX")
+    {
+        auto targets = MakeTargets(37);
+        Ballistics::SolveAVX(targets.Batch(), kArrowSpeed, kArrowGravity);
+        for (std::size_t i = 0; i < targets.pitch.size(); ++i) {
+            CHECK(targets.pitch[i] == Catch::Approx(reference.pitch[i]).margin(1.0e-5));
+            CHECK(targets.yaw[i] == Catch::Approx(reference.yaw[i]).margin(1.0e-5));
+        }
+    }
+}
+
+TEST_CASE("Ballistics/ZeroGravityAimsStraight")
+{
+    auto targets = MakeTargets(16);
+    Ballistics::Solve(targets.Batch(), kArrowSpeed, 0.0f);
+    for (std::size_t i = 0; i < targets.pitch.size(); ++i) {
+        float horizontal = std::sqrt(targets.dx[i] * targets.dx[i] + targets.dy[i] * targets.dy[i]);
+        CHECK(targets.pitch[i] == Catch::Approx(-std::atan2(targets.dz[i], horizontal)).margin(1.0e-5));
+    }
+}
+
+TEST_CASE("Ballistics/UnreachableTargetsAreCounted")
+{
+    Targets targets(5);
+    for (std::size_t i = 0; i < 5; ++i) {
+        targets.dy[i] = i < 2 ? 1000.0f : 1.0e7f;
+    }
+    auto batch = targets.Batch();
+    CHECK(Ballistics::SolveScalar(batch, kArrowSpeed, kArrowGravity) == 3);
+    CHECK(Ballistics::Solve(batch, kArrowSpeed, kArrowGravity) == 3);
+    for (std::size_t i = 2; i < 5; ++i) {
+        // Max-range fallback aims upward at 45 degrees on flat ground
+        CHECK(targets.pitch[i] < 0.0f);
+        CHECK(std::isfinite(targets.pitch[i]));
+    }
+}
+
+TEST_CASE("Ballistics/Benchmark", "[!benchmark]")
+{
+    for (std::size_t count : { std::size_t{ 8 }, std::size_t{ 1024 } }) {
+        auto targets = MakeTargets(count);
+        auto batch = targets.Batch();
+
+        BENCHMARK("Scalar x" + std::to_string(count)) { return Ballistics::SolveScalar(batch, kArrowSpeed, kArrowGravity); };
+        BENCHMARK("SSE x" + std::to_string(count)) { return Ballistics::SolveSSE(batch, kArrowSpeed, kArrowGravity); };
+        BENCHMARK("AVX x" + std::to_string(count)) { return Ballistics::SolveAVX(batch, kArrowSpeed, kArrowGravity); };
+    }
+}
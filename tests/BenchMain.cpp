@@ -0,0 +1,101 @@
+// Runs the Catch2 suite and, with --json, also writes every benchmark result
+// to a file so runs can be diffed or tracked over time.
+//
+//   ArcheryTechniquesBenchmarks "[!benchmark]" --json bench.json
+
+#define CATCH_CONFIG_RUNNER
+#include "catch2/catch_all.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+    struct Result {
+        std::string testCase;
+        std::string name;
+        double meanNs = 0.0;
+        double stdDevNs = 0.0;
+        int samples = 0;
+        int iterations = 0;
+    };
+
+    std::string jsonPath;
+
+    void WriteEscaped(std::FILE* file, const std::string& text)
+    {
+        std::fputc('"', file);
+        for (char c : text) {
+            if (c == '"' || c == '\\') {
+                std::fputc('\\', file);
+            }
+            std::fputc(c, file);
+        }
+        std::fputc('"', file);
+    }
+
+    class JsonListener : public Catch::EventListenerBase {
+    public:
+        using Catch::EventListenerBase::EventListenerBase;
+
+        void testCaseStarting(const Catch::TestCaseInfo& info) override { testCase = info.name; }
+
+        void benchmarkEnded(const Catch::BenchmarkStats<>& stats) override
+        {
+            Result result;
+            result.testCase = testCase;
+            result.name = stats.info.name;
+            result.meanNs = stats.mean.point.count();
+            result.stdDevNs = stats.standardDeviation.point.count();
+            result.samples = static_cast<int>(stats.info.samples);
+            result.iterations = static_cast<int>(stats.info.iterations);
+            results.push_back(std::move(result));
+        }
+
+        void testRunEnded(const Catch::TestRunStats&) override
+        {
+            if (jsonPath.empty()) {
+                return;
+            }
+            std::FILE* file = std::fopen(jsonPath.c_str(), "w");
+            if (!file) {
+                std::fprintf(stderr, "cannot write %s\n", jsonPath.c_str());
+                return;
+            }
+
+            std::fputs("{\n  \"benchmarks\": [", file);
+            for (std::size_t i = 0; i < results.size(); ++i) {
+                const auto& result = results[i];
+                std::fputs(i ? ",\n    {\"test_case\": " : "\n    {\"test_case\": ", file);
+                WriteEscaped(file, result.testCase);
+                std::fputs(", \"name\": ", file);
+                WriteEscaped(file, result.name);
+                std::fprintf(file, ", \"mean_ns\": %.3f, \"stddev_ns\": %.3f, \"samples\": %d, \"iterations\": %d}", result.meanNs, result.stdDevNs,
+                             result.samples, result.iterations);
+            }
+            std::fputs("\n  ]\n}\n", file);
+            std::fclose(file);
+        }
+
+    private:
+        std::string testCase;
+        std::vector<Result> results;
+    };
+}
+
+CATCH_REGISTER_LISTENER(JsonListener)
+
+int main(int argc, char** argv)
+{
+    // --json <file> is ours; everything else goes to Catch
+    std::vector<char*> args;
+    for (int i = 0; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--json") == 0 && i + 1 < argc) {
+            jsonPath = argv[++i];
+            continue;
+        }
+        args.push_back(argv[i]);
+    }
+    return Catch::Session().run(static_cast<int>(args.size()), args.data());
+}
@@ -0,0 +1,93 @@
+#include "catch2/catch_all.hpp"
+
+#include "DrawDetector.h"
+#include <vector>
+
+using DrawDetector::Edge;
+
+TEST_CASE("DrawDetector/StartsAndStopsOnDraw")
+{
+    DrawDetector::Detector detector;
+
+    CHECK(detector.Step({ true, 0.0f, 20.0f }) == Edge::None);
+    CHECK(detector.Step({ true, 0.2f, 30.0f }) == Edge::Started);
+    CHECK(detector.IsDrawing());
+    CHECK(detector.Step({ true, 0.8f, 60.0f }) == Edge::None);
+    CHECK(detector.Step({ true, 0.0f, 20.0f }) == Edge::Stopped);
+    CHECK_FALSE(detector.IsDrawing());
+}
+
+TEST_CASE("DrawDetector/HysteresisIgnoresJitter")
+{
+    DrawDetector::Detector detector;
+
+    // Hovering between the thresholds neither starts nor stops a draw
+    CHECK(detector.Step({ true, 0.05f, 20.0f }) == Edge::None);
+    CHECK(detector.Step({ true, 0.12f, 25.0f }) == Edge::Started);
+    CHECK(detector.Step({ true, 0.05f, 22.0f }) == Edge::None);
+    CHECK(detector.Step({ true, 0.08f, 23.0f }) == Edge::None);
+    CHECK(detector.IsDrawing());
+}
+
+TEST_CASE("DrawDetector/UnknockedArrowStopsDraw")
+{
+    DrawDetector::Detector detector;
+
+    CHECK(detector.Step({ false, 1.0f, 60.0f }) == Edge::None);
+    CHECK(detector.Step({ true, 1.0f, 60.0f }) == Edge::Started);
+    CHECK(detector.Step({ false, 1.0f, 60.0f }) == Edge::Stopped);
+}
+
+TEST_CASE("DrawDetector/StrengthFromHandDistance")
+{
+    CHECK(DrawDetector::ComputeStrength(20.0f, 20.0f, 50.0f) == 0.0f);
+    CHECK(DrawDetector::ComputeStrength(45.0f, 20.0f, 50.0f) == Catch::Approx(0.5f));
+    CHECK(DrawDetector::ComputeStrength(90.0f, 20.0f, 50.0f) == 1.0f);
+    CHECK(DrawDetector::ComputeStrength(10.0f, 20.0f, 50.0f) == 0.0f);
+}
+
+TEST_CASE("DrawDetector/ChargeScalesWithStrength")
+{
+    constexpr float kFrame = 1.0f / 90.0f;
+
+    auto framesToCharge = [&](float strength) {
+        DrawDetector::ChargeIntegrator integrator;
+        int frames = 0;
+        while (!integrator.IsComplete() && frames < 100000) {
+            integrator.Advance(strength, kFrame, 3.0f);
+            ++frames;
+        }
+        return frames;
+    };
+
+    // Full draw charges in fChargeTime, half draw takes twice as long, no draw never charges
+    CHECK(framesToCharge(1.0f) == Catch::Approx(270).margin(1));
+    CHECK(framesToCharge(0.5f) == Catch::Approx(540).margin(1));
+    CHECK(framesToCharge(0.0f) == 100000);
+}
+
+TEST_CASE("DrawDetector/HistoryKeepsRecentWindow")
+{
+    DrawDetector::History<4> history;
+    CHECK(history.Size() == 0);
+    CHECK(history.MeanStrength() == 0.0f);
+    CHECK(history.Newest() == nullptr);
+
+    for (int i = 1; i <= 6; ++i) {
+        history.Push({ static_cast<float>(i) / 10.0f, 0.0f, 0.0f, 0.011f });
+    }
+
+    // Oldest two were overwritten: 0.3, 0.4, 0.5, 0.6 remain in order
+    CHECK(history.Size() == 4);
+    CHECK(history.MeanStrength() == Catch::Approx(0.45f));
+    CHECK(history.PeakStrength() == Catch::Approx(0.6f));
+
+    REQUIRE(history.Newest());
+    CHECK(history.Newest()->strength == Catch::Approx(0.6f));
+
+    std::vector<float> order;
+    history.ForEach([&](const DrawDetector::HistoryEntry& entry) { order.push_back(entry.strength); });
+    REQUIRE(order.size() == 4);
+    CHECK(order.front() == Catch::Approx(0.3f));
+    CHECK(order.back() == Catch::Approx(0.6f));
+}
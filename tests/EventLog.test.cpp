@@ -0,0 +1,194 @@
+#include "catch2/catch_all.hpp"
+
+#include "EventLog.h"
+#include "EventReplay.h"
+#include "MockGame.h"
+#include <cstdio>
+#include <filesystem>
+#include <vector>
+
+namespace {
+    using EventLog::Record;
+    using EventLog::Tag;
+    using EventLog::Type;
+
+    // Plays a session against live logic and records it the way the plugin does
+    struct Session {
+        MockGame game;
+        MultishotConfig multishotConfig;
+        PenetratingArrowConfig penetratingConfig;
+        MultishotLogic multishot{ game, multishotConfig };
+        PenetratingLogic penetrating{ game, penetratingConfig, multishot };
+        std::vector<Record> records;
+        std::uint32_t lastState = ~0u;
+
+        EventLog::Header MakeHeader() const
+        {
+            EventLog::Header header;
+            header.multishot = multishotConfig;
+            header.penetratingArrow = penetratingConfig;
+            return header;
+        }
+
+        void Append(Type type, std::uint16_t flags = 0, std::uint32_t data = 0, float value = 0.0f)
+        {
+            Record record;
+            record.type = type;
+            record.flags = flags;
+            record.data = data;
+            record.value = value;
+            records.push_back(record);
+        }
+
+        // One frame: tick, penetrating update, checkpoint
+        void Frame(float delta)
+        {
+            game.Advance(delta);
+            std::uint16_t facts = EventLog::kPresent | EventLog::kHasBow | EventLog::kHasAmmo | EventLog::kMultishotPerk | EventLog::kPenetratingPerk;
+            Append(Type::Frame, facts, 0, delta);
+
+            Append(Type::Update);
+            penetrating.Update();
+            multishot.Update();
+
+            auto state = EventLog::PackState(static_cast<std::uint8_t>(multishot.GetState()), static_cast<std::uint8_t>(penetrating.GetState()));
+            if (state != lastState) {
+                lastState = state;
+                Append(Type::State, 0, state);
+            }
+        }
+
+        void KeyPress()
+        {
+            Append(Type::KeyPress, 0, 46);
+            multishot.TryActivate();
+        }
+
+        void BowDraw()
+        {
+            Append(Type::AnimTag, static_cast<std::uint16_t>(Game::Technique::PenetratingArrow), static_cast<std::uint32_t>(Tag::BowDraw));
+            penetrating.OnBowDrawStart();
+        }
+
+        void Release()
+        {
+            Append(Type::AnimTag, static_cast<std::uint16_t>(Game::Technique::Multishot), static_cast<std::uint32_t>(Tag::ArrowRelease),
+                   static_cast<float>(game.ammo));
+            multishot.OnArrowRelease();
+            Append(Type::AnimTag, static_cast<std::uint16_t>(Game::Technique::PenetratingArrow), static_cast<std::uint32_t>(Tag::ArrowRelease));
+            penetrating.OnArrowRelease();
+        }
+    };
+
+    // Battle at 90 fps: a drawn shot every ~4s, multishot key every 30s
+    void PlayBattle(Session& session, float seconds)
+    {
+        constexpr float kDelta = 1.0f / 90.0f;
+        int frames = static_cast<int>(seconds / kDelta);
+        for (int frame = 0; frame < frames; ++frame) {
+            int cycle = frame % 360;
+            if (frame % 2700 == 0) {
+                session.KeyPress();
+            }
+            if (cycle < 300 && cycle % 54 == 0) {
+                session.BowDraw();
+            }
+            if (cycle == 300) {
+                session.Release();
+            }
+            session.Frame(kDelta);
+        }
+    }
+
+    std::filesystem::path TempLog(const char* name)
+    {
+        return std::filesystem::temp_directory_path() / name;
+    }
+}
+
+TEST_CASE("EventLog/ClassifyTag")
+{
+    CHECK(EventLog::ClassifyTag("arrowRelease") == Tag::ArrowRelease);
+    CHECK(EventLog::ClassifyTag("bowDrawStart") == Tag::BowDraw);
+    CHECK(EventLog::ClassifyTag("bowUnDraw") == Tag::BowDrawStop);
+    CHECK(EventLog::ClassifyTag("bowRelease") == Tag::BowDrawStop);
+    CHECK(EventLog::ClassifyTag("FootLeft") == Tag::Other);
+    CHECK(EventLog::ClassifyTag("BowDrawStop") == Tag::BowDrawStop);
+    CHECK(EventLog::ClassifyTag("bowDrawStarts") == Tag::Other);
+}
+
+TEST_CASE("EventLog/RoundTrip")
+{
+    Session session;
+    session.multishotConfig.arrowCount = 7;
+    PlayBattle(session, 10.0f);
+
+    auto path = TempLog("ArcheryTechniques.roundtrip.events");
+    {
+        EventLog::Writer writer;
+        REQUIRE(writer.Open(path, session.MakeHeader()));
+        for (const auto& record : session.records) {
+            writer.Append(record);
+        }
+        CHECK(writer.Count() == session.records.size());
+    }
+
+    EventLog::Header header;
+    std::vector<Record> records;
+    REQUIRE(EventLog::Read(path, header, records));
+    CHECK(header.multishot.arrowCount == 7);
+    REQUIRE(records.size() == session.records.size());
+    CHECK(records.back().type == session.records.back().type);
+    CHECK(records.back().data == session.records.back().data);
+
+    // A record cut short by a crash is dropped
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 5);
+    REQUIRE(EventLog::Read(path, header, records));
+    CHECK(records.size() == session.records.size() - 1);
+
+    // Anything that is not a log is rejected
+    std::FILE* file = std::fopen(path.string().c_str(), "wb");
+    std::fputs("not an event log", file);
+    std::fclose(file);
+    CHECK_FALSE(EventLog::Read(path, header, records));
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("EventLog/ReplayMatchesRecording")
+{
+    Session session;
+    PlayBattle(session, 120.0f);
+    REQUIRE(session.game.volleys > 0);
+    REQUIRE(session.game.penetratingShots > 0);
+
+    EventReplay replay(session.MakeHeader());
+    replay.Run(session.records);
+    CHECK(replay.DivergenceCount() == 0);
+    CHECK(replay.Launches() == static_cast<std::size_t>(session.game.volleys + session.game.penetratingShots));
+    CHECK(replay.GetGame().ammo == session.game.ammo);
+
+    // A different config plays out differently and is reported
+    auto header = session.MakeHeader();
+    header.penetratingArrow.chargeTime = 5.0f;
+    EventReplay mismatched(header);
+    mismatched.Run(session.records);
+    CHECK(mismatched.DivergenceCount() > 0);
+    REQUIRE_FALSE(mismatched.Divergences().empty());
+    CHECK(mismatched.Divergences().front().expectedPenetrating != mismatched.Divergences().front().actualPenetrating);
+}
+
+TEST_CASE("EventLog/Benchmark", "[!benchmark]")
+{
+    // Five minutes of battle, replayed end to end
+    Session session;
+    PlayBattle(session, 300.0f);
+    auto header = session.MakeHeader();
+
+    BENCHMARK("Replay 5 min battle (" + std::to_string(session.records.size()) + " records)")
+    {
+        EventReplay replay(header);
+        replay.Run(session.records);
+        return replay.Launches();
+    };
+}
@@ -0,0 +1,169 @@
+#pragma once
+
+#include "EventLog.h"
+#include "MockGame.h"
+#include "TechniqueLogic.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// ============================================
+// Event replay
+// ============================================
+// Feeds a recorded event stream into fresh technique logic on a MockGame,
+// routing each record the way the plugin's handlers and frame hook do, and
+// compares the logic's states against every recorded checkpoint.
+class EventReplay
+{
+public:
+    struct Divergence {
+        std::size_t record = 0;
+        MultishotState expectedMultishot{};
+        MultishotState actualMultishot{};
+        PenetratingArrowState expectedPenetrating{};
+        PenetratingArrowState actualPenetrating{};
+    };
+
+    // Only the first few divergences are kept; the count covers all of them
+    static constexpr std::size_t kMaxKeptDivergences = 16;
+
+    explicit EventReplay(const EventLog::Header& header) :
+        multishotConfig(header.multishot),
+        penetratingConfig(header.penetratingArrow)
+    {
+    }
+
+    void Step(const EventLog::Record& record)
+    {
+        using EventLog::Type;
+
+        switch (record.type) {
+        case Type::Frame:
+            ApplyFrame(record);
+            ++frames;
+            break;
+        case Type::Update:
+            penetrating.Update();
+            multishot.Update();
+            break;
+        case Type::KeyPress:
+            multishot.TryActivate();
+            break;
+        case Type::AnimTag:
+            ApplyTag(record);
+            break;
+        case Type::DrawStart:
+            game.drawing = true;
+            penetrating.OnBowDrawStart();
+            break;
+        case Type::DrawStop:
+            game.drawing = false;
+            penetrating.OnBowDrawStop();
+            break;
+        case Type::DrawFrame:
+            penetrating.OnDrawFrame(record.value, frameDelta);
+            break;
+        case Type::State:
+            Check(record);
+            break;
+        }
+        ++position;
+    }
+
+    void Run(const std::vector<EventLog::Record>& records)
+    {
+        for (const auto& record : records) {
+            Step(record);
+        }
+    }
+
+    const MultishotLogic& Multishot() const { return multishot; }
+    const PenetratingLogic& Penetrating() const { return penetrating; }
+    const MockGame& GetGame() const { return game; }
+
+    std::size_t Frames() const { return frames; }
+    std::size_t Launches() const { return static_cast<std::size_t>(game.volleys + game.penetratingShots); }
+    std::size_t DivergenceCount() const { return divergenceCount; }
+    const std::vector<Divergence>& Divergences() const { return divergences; }
+
+private:
+    void ApplyFrame(const EventLog::Record& record)
+    {
+        using namespace EventLog;
+
+        frameDelta = record.value;
+        game.Advance(record.value);
+        game.shooter.present = record.flags & kPresent;
+        game.shooter.incapacitated = record.flags & kIncapacitated;
+        game.shooter.paused = record.flags & kPaused;
+        game.shooter.hasBow = record.flags & kHasBow;
+        game.shooter.hasAmmo = record.flags & kHasAmmo;
+        game.multishotPerk = record.flags & kMultishotPerk;
+        game.penetratingPerk = record.flags & kPenetratingPerk;
+        game.drawTracked = record.flags & kDrawTracked;
+        game.drawing = record.flags & kDrawing;
+    }
+
+    void ApplyTag(const EventLog::Record& record)
+    {
+        using EventLog::Tag;
+
+        auto tag = static_cast<Tag>(record.data);
+        if (static_cast<Game::Technique>(record.flags) == Game::Technique::Multishot) {
+            if (tag == Tag::ArrowRelease) {
+                game.ammo = static_cast<int>(record.value);
+                multishot.OnArrowRelease();
+            }
+            return;
+        }
+
+        // In VR the draw tracker reports start/stop; only the release comes from the graph
+        if (game.drawTracked && tag != Tag::ArrowRelease) {
+            return;
+        }
+        switch (tag) {
+        case Tag::BowDraw:
+            penetrating.OnBowDrawStart();
+            break;
+        case Tag::BowDrawStop:
+            penetrating.OnBowDrawStop();
+            break;
+        case Tag::ArrowRelease:
+            penetrating.OnArrowRelease();
+            break;
+        default:
+            break;
+        }
+    }
+
+    void Check(const EventLog::Record& record)
+    {
+        auto actual = EventLog::PackState(static_cast<std::uint8_t>(multishot.GetState()), static_cast<std::uint8_t>(penetrating.GetState()));
+        if (actual == record.data) {
+            return;
+        }
+
+        ++divergenceCount;
+        if (divergences.size() < kMaxKeptDivergences) {
+            Divergence divergence;
+            divergence.record = position;
+            divergence.expectedMultishot = static_cast<MultishotState>(record.data & 0xFF);
+            divergence.actualMultishot = multishot.GetState();
+            divergence.expectedPenetrating = static_cast<PenetratingArrowState>((record.data >> 8) & 0xFF);
+            divergence.actualPenetrating = penetrating.GetState();
+            divergences.push_back(divergence);
+        }
+    }
+
+    MockGame game;
+    MultishotConfig multishotConfig;
+    PenetratingArrowConfig penetratingConfig;
+    MultishotLogic multishot{ game, multishotConfig };
+    PenetratingLogic penetrating{ game, penetratingConfig, multishot };
+
+    float frameDelta = 0.0f;
+    std::size_t position = 0;
+    std::size_t frames = 0;
+    std::size_t divergenceCount = 0;
+    std::vector<Divergence> divergences;
+};
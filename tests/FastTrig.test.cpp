@@ -0,0 +1,192 @@
+#include "catch2/catch_all.hpp"
+
+#include "FastTrig.h"
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace {
+    struct MaxError {
+        double worst = 0.0;
+        float at = 0.0f;
+
+        void Add(double error, float input)
+        {
+            if (!(error <= worst)) {
+                worst = error;
+                at = input;
+            }
+        }
+    };
+
+    // Every sweep also runs through the span forms; 37 keeps the SIMD tails in play
+    constexpr std::size_t kChunk = 37;
+}
+
+TEST_CASE("FastTrig/SinCosAccuracySweep")
+{
+    std::vector<float> x;
+    for (float v = -FastTrig::kSinCosRange; v <= FastTrig::kSinCosRange; v += 0.0123f) {
+        x.push_back(v);
+    }
+    // Quadrant boundaries, where the reduction switches polynomials
+    for (int q = -64; q <= 64; ++q) {
+        float boundary = static_cast<float>(q) * FastTrig::kHalfPi;
+        x.push_back(boundary);
+        x.push_back(std::nextafter(boundary, 1.0e9f));
+        x.push_back(std::nextafter(boundary, -1.0e9f));
+        x.push_back(boundary + FastTrig::kHalfPi / 2.0f);
+    }
+
+    std::vector<float> sin(x.size());
+    std::vector<float> cos(x.size());
+    for (std::size_t i = 0; i < x.size(); i += kChunk) {
+        FastTrig::SinCos(x.data() + i, sin.data() + i, cos.data() + i, std::min(kChunk, x.size() - i));
+    }
+
+    MaxError sinError, cosError, spanError;
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        sinError.Add(std::fabs(FastTrig::Sin(x[i]) - std::sin(static_cast<double>(x[i]))), x[i]);
+        cosError.Add(std::fabs(FastTrig::Cos(x[i]) - std::cos(static_cast<double>(x[i]))), x[i]);
+        spanError.Add(std::fabs(sin[i] - std::sin(static_cast<double>(x[i]))), x[i]);
+        spanError.Add(std::fabs(cos[i] - std::cos(static_cast<double>(x[i]))), x[i]);
+    }
+    INFO("sin " << sinError.worst << " at " << sinError.at);
+    INFO("cos " << cosError.worst << " at " << cosError.at);
+    INFO("span " << spanError.worst << " at " << spanError.at);
+    CHECK(sinError.worst <= FastTrig::kSinCosMaxError);
+    CHECK(cosError.worst <= FastTrig::kSinCosMaxError);
+    CHECK(spanError.worst <= FastTrig::kSinCosMaxError);
+
+    CHECK(FastTrig::Sin(0.0f) == 0.0f);
+    CHECK(FastTrig::Cos(0.0f) == 1.0f);
+}
+
+TEST_CASE("FastTrig/AtanAccuracySweep")
+{
+    std::vector<float> x = { 0.0f, -0.0f, 1.0f, -1.0f, 1.0e30f, -1.0e30f,
+                             std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity() };
+    for (float v = 1.0e-6f; v < 1.0e7f; v *= 1.0007f) {
+        x.push_back(v);
+        x.push_back(-v);
+    }
+
+    std::vector<float> out(x.size());
+    for (std::size_t i = 0; i < x.size(); i += kChunk) {
+        FastTrig::Atan(x.data() + i, out.data() + i, std::min(kChunk, x.size() - i));
+    }
+
+    MaxError scalarError, spanError;
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        double expected = std::atan(static_cast<double>(x[i]));
+        scalarError.Add(std::fabs(FastTrig::Atan(x[i]) - expected), x[i]);
+        spanError.Add(std::fabs(out[i] - expected), x[i]);
+    }
+    INFO("scalar " << scalarError.worst << " at " << scalarError.at);
+    INFO("span " << spanError.worst << " at " << spanError.at);
+    CHECK(scalarError.worst <= FastTrig::kAtanMaxError);
+    CHECK(spanError.worst <= FastTrig::kAtanMaxError);
+}
+
+TEST_CASE("FastTrig/Atan2AccuracySweep")
+{
+    std::vector<float> y, x;
+    for (float radius : { 1.0e-3f, 1.0f, 37.5f, 8000.0f }) {
+        for (float angle = -3.2f; angle <= 3.2f; angle += 1.0e-4f) {
+            y.push_back(radius * std::sin(angle));
+            x.push_back(radius * std::cos(angle));
+        }
+    }
+
+    std::vector<float> out(x.size());
+    for (std::size_t i = 0; i < x.size(); i += kChunk) {
+        FastTrig::Atan2(y.data() + i, x.data() + i, out.data() + i, std::min(kChunk, x.size() - i));
+    }
+
+    MaxError scalarError, spanError;
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        double expected = std::atan2(static_cast<double>(y[i]), static_cast<double>(x[i]));
+        scalarError.Add(std::fabs(FastTrig::Atan2(y[i], x[i]) - expected), static_cast<float>(expected));
+        spanError.Add(std::fabs(out[i] - expected), static_cast<float>(expected));
+    }
+    INFO("scalar " << scalarError.worst << " at angle " << scalarError.at);
+    INFO("span " << spanError.worst << " at angle " << spanError.at);
+    CHECK(scalarError.worst <= FastTrig::kAtanMaxError);
+    CHECK(spanError.worst <= FastTrig::kAtanMaxError);
+}
+
+TEST_CASE("FastTrig/Atan2SignedZeros")
+{
+    // Same results as std::atan2, for the axes the game hits when aiming straight along them
+    const float cases[][2] = {
+        { 0.0f, 0.0f }, { -0.0f, 0.0f }, { 0.0f, -0.0f }, { -0.0f, -0.0f },
+        { 0.0f, 1.0f }, { -0.0f, 1.0f }, { 0.0f, -1.0f }, { -0.0f, -1.0f },
+        { 1.0f, 0.0f }, { -1.0f, 0.0f }, { 1.0f, -0.0f }, { -1.0f, -0.0f },
+    };
+    std::vector<float> y, x;
+    for (const auto& c : cases) {
+        y.push_back(c[0]);
+        x.push_back(c[1]);
+    }
+    std::vector<float> out(y.size());
+    FastTrig::Atan2(y.data(), x.data(), out.data(), out.size());
+
+    for (std::size_t i = 0; i < y.size(); ++i) {
+        INFO("atan2(" << y[i] << ", " << x[i] << ")");
+        float expected = std::atan2(y[i], x[i]);
+        CHECK(FastTrig::Atan2(y[i], x[i]) == Catch::Approx(expected).margin(FastTrig::kAtanMaxError));
+        CHECK(std::signbit(FastTrig::Atan2(y[i], x[i])) == std::signbit(expected));
+        CHECK(out[i] == Catch::Approx(expected).margin(FastTrig::kAtanMaxError));
+        CHECK(std::signbit(out[i]) == std::signbit(expected));
+    }
+}
+
+TEST_CASE("FastTrig/Benchmark", "[!benchmark]")
+{
+    constexpr std::size_t kCount = 1024;
+    std::vector<float> a(kCount), b(kCount), out0(kCount), out1(kCount);
+    for (std::size_t i = 0; i < kCount; ++i) {
+        a[i] = static_cast<float>(i) * 0.0137f - 7.0f;
+        b[i] = static_cast<float>(kCount - i) * 0.0091f - 4.0f;
+    }
+
+    BENCHMARK("std::sin + std::cos x1024")
+    {
+        for (std::size_t i = 0; i < kCount; ++i) {
+            out0[i] = std::sin(a[i]);
+            out1[i] = std::cos(a[i]);
+        }
+        return out0.back() + out1.back();
+    };
+    BENCHMARK("FastTrig::SinCos scalar x1024")
+    {
+        for (std::size_t i = 0; i < kCount; ++i) {
+            FastTrig::SinCos(a[i], out0[i], out1[i]);
+        }
+        return out0.back() + out1.back();
+    };
+    BENCHMARK("FastTrig::SinCos span x1024")
+    {
+        FastTrig::SinCos(a.data(), out0.data(), out1.data(), kCount);
+        return out0.back() + out1.back();
+    };
+    BENCHMARK("std::atan2 x1024")
+    {
+        for (std::size_t i = 0; i < kCount; ++i) {
+            out0[i] = std::atan2(a[i], b[i]);
+        }
+        return out0.back();
+    };
+    BENCHMARK("FastTrig::Atan2 scalar x1024")
+    {
+        for (std::size_t i = 0; i < kCount; ++i) {
+            out0[i] = FastTrig::Atan2(a[i], b[i]);
+        }
+        return out0.back();
+    };
+    BENCHMARK("FastTrig::Atan2 span x1024")
+    {
+        FastTrig::Atan2(a.data(), b.data(), out0.data(), kCount);
+        return out0.back();
+    };
+}
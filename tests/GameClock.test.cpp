@@ -0,0 +1,70 @@
+#include "catch2/catch_all.hpp"
+
+#include "GameClock.h"
+
+namespace {
+    using namespace std::chrono_literals;
+}
+
+TEST_CASE("GameClock/AdvancesOncePerTick")
+{
+    GameClock clock;
+    GameClock::RealTime start{};
+
+    clock.Tick(start, 0.011f, false);
+    CHECK(clock.FrameNumber() == 1);
+    CHECK(clock.RealDelta() == 0.0f);
+    CHECK(clock.GameDelta() == Catch::Approx(0.011f));
+
+    clock.Tick(start + 11ms, 0.011f, false);
+    CHECK(clock.FrameNumber() == 2);
+    CHECK(clock.RealDelta() == Catch::Approx(0.011f));
+    CHECK(clock.GameTime() == Catch::Approx(0.022));
+    CHECK(clock.RealNow() == start + 11ms);
+}
+
+TEST_CASE("GameClock/PauseStopsGameTime")
+{
+    GameClock clock;
+    GameClock::RealTime start{};
+
+    clock.Tick(start, 0.1f, false);
+    double before = clock.GameTime();
+
+    // A second of menu time passes in real time only
+    clock.Tick(start + 500ms, 0.011f, true);
+    clock.Tick(start + 1000ms, 0.011f, true);
+    CHECK(clock.IsPaused());
+    CHECK(clock.GameDelta() == 0.0f);
+    CHECK(clock.GameTime() == before);
+    CHECK(clock.RealDelta() == Catch::Approx(0.5f));
+
+    clock.Tick(start + 1011ms, 0.011f, false);
+    CHECK(clock.Since(before) == Catch::Approx(0.011f));
+}
+
+TEST_CASE("GameClock/ClampsLongFrames")
+{
+    GameClock clock;
+    GameClock::RealTime start{};
+
+    // A loading screen hitch must not burn through a cooldown in one frame
+    clock.Tick(start, 12.0f, false);
+    CHECK(clock.GameDelta() == 0.25f);
+    clock.Tick(start + 1ms, -1.0f, false);
+    CHECK(clock.GameDelta() == 0.0f);
+    CHECK(clock.GameTime() == Catch::Approx(0.25));
+}
+
+TEST_CASE("GameClock/FrameGateOncePerFrame")
+{
+    GameClock clock;
+    FrameGate gate;
+
+    CHECK(gate.Enter(clock.FrameNumber()));
+    CHECK_FALSE(gate.Enter(clock.FrameNumber()));
+
+    clock.Tick(GameClock::RealTime{}, 0.011f, false);
+    CHECK(gate.Enter(clock.FrameNumber()));
+    CHECK_FALSE(gate.Enter(clock.FrameNumber()));
+}
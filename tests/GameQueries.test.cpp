@@ -0,0 +1,76 @@
+#include "catch2/catch_all.hpp"
+
+#include "GameQueries.h"
+#include "GameStandIns.h"
+#include <vector>
+
+namespace {
+    using StandIn::Device;
+    using StandIn::EventType;
+
+    const StandIn::InputEvent* FindKeyPress(StandIn::InputEvent* chain, std::uint32_t keyCode)
+    {
+        return GameQueries::FindKeyPress<EventType::kButton, Device::kKeyboard>(chain, keyCode);
+    }
+}
+
+TEST_CASE("GameQueries/FindKeyPressSkipsOtherInput")
+{
+    constexpr std::uint32_t kKey = 0x2F;
+    std::vector<StandIn::InputEvent> events{
+        { EventType::kMouseMove, Device::kMouse, kKey, 1.0f },
+        { EventType::kButton, Device::kGamepad, kKey, 1.0f },
+        { EventType::kButton, Device::kKeyboard, kKey, 1.0f, 0.3f }, // held
+        { EventType::kButton, Device::kKeyboard, kKey, 0.0f, 0.5f }, // released
+        { EventType::kButton, Device::kKeyboard, kKey + 1, 1.0f },
+    };
+    CHECK(FindKeyPress(StandIn::Link(events), kKey) == nullptr);
+
+    events.push_back({ EventType::kButton, Device::kKeyboard, kKey, 1.0f });
+    events.push_back({ EventType::kButton, Device::kKeyboard, kKey, 1.0f });
+    CHECK(FindKeyPress(StandIn::Link(events), kKey) == &events[5]);
+    CHECK(FindKeyPress(nullptr, kKey) == nullptr);
+}
+
+TEST_CASE("GameQueries/NewerPlayerArrow")
+{
+    StandIn::Handle player{ 7 };
+    StandIn::Handle other{ 8 };
+    int missileChecks = 0;
+    auto missile = [&] { ++missileChecks; return true; };
+    auto notMissile = [&] { ++missileChecks; return false; };
+
+    CHECK(GameQueries::IsNewerPlayerArrow(0.05f, 0.5f, player, player, missile));
+    CHECK_FALSE(GameQueries::IsNewerPlayerArrow(0.05f, 0.5f, player, player, notMissile));
+    CHECK(missileChecks == 2);
+
+    // Older arrows and other shooters are ruled out before the missile check
+    CHECK_FALSE(GameQueries::IsNewerPlayerArrow(0.5f, 0.5f, player, player, missile));
+    CHECK_FALSE(GameQueries::IsNewerPlayerArrow(0.05f, 0.5f, other, player, missile));
+    CHECK(missileChecks == 2);
+}
+
+TEST_CASE("GameQueries/CountItemMatchesInventoryTotal")
+{
+    StandIn::BoundObject arrows{ 0x1397D };
+    StandIn::BoundObject potion{ 0x39BE5 };
+    int baseCalls = 0;
+    auto base = [&] { ++baseCalls; return 24; };
+
+    std::vector<StandIn::InventoryEntry*> none;
+    CHECK(GameQueries::CountItem(none, &arrows, base) == 24);
+
+    // Change delta on top of the container's count; only the first entry counts
+    StandIn::InventoryEntry potions{ &potion, 3 };
+    StandIn::InventoryEntry shot{ &arrows, -5 };
+    StandIn::InventoryEntry duplicate{ &arrows, 100 };
+    std::vector<StandIn::InventoryEntry*> entries{ nullptr, &potions, &shot, &duplicate };
+    CHECK(GameQueries::CountItem(entries, &arrows, base) == 19);
+
+    // A leveled entry already holds the full count
+    shot.countDelta = 12;
+    shot.leveled = true;
+    baseCalls = 0;
+    CHECK(GameQueries::CountItem(entries, &arrows, base) == 12);
+    CHECK(baseCalls == 0);
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+// ============================================
+// Game type stand-ins
+// ============================================
+// Plain structs with the member names of the CommonLib types GameQueries
+// reads, so its templates run headless the way the plugin instantiates them.
+namespace StandIn {
+    enum class EventType : std::uint32_t { kButton, kMouseMove, kChar, kThumbstick };
+    enum class Device : std::uint32_t { kKeyboard, kMouse, kGamepad, kVRRight, kVRLeft };
+
+    // InputEvent and ButtonEvent in one: only buttons answer AsButtonEvent()
+    struct InputEvent {
+        EventType type = EventType::kButton;
+        Device device = Device::kKeyboard;
+        std::uint32_t idCode = 0;
+        float value = 0.0f;
+        float heldDownSecs = 0.0f;
+        InputEvent* next = nullptr;
+
+        EventType GetEventType() const { return type; }
+        Device GetDevice() const { return device; }
+        std::uint32_t GetIDCode() const { return idCode; }
+        bool IsDown() const { return value > 0.0f && heldDownSecs == 0.0f; }
+        const InputEvent* AsButtonEvent() const { return type == EventType::kButton ? this : nullptr; }
+    };
+
+    // Links events into a chain the way the input manager hands them over
+    inline InputEvent* Link(std::vector<InputEvent>& events)
+    {
+        for (std::size_t i = 0; i + 1 < events.size(); ++i) {
+            events[i].next = &events[i + 1];
+        }
+        return events.empty() ? nullptr : events.data();
+    }
+
+    // ObjectRefHandle: compares by value
+    struct Handle {
+        std::uint32_t value = 0;
+        friend bool operator==(const Handle&, const Handle&) = default;
+    };
+
+    struct BoundObject {
+        std::uint32_t formID = 0;
+    };
+
+    struct InventoryEntry {
+        BoundObject* object = nullptr;
+        std::int32_t countDelta = 0;
+        bool leveled = false;
+
+        bool IsLeveled() const { return leveled; }
+    };
+}
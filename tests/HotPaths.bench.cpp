@@ -0,0 +1,349 @@
+#include "catch2/catch_all.hpp"
+
+#include "EventLog.h"
+#include "FastTrig.h"
+#include "GameClock.h"
+#include "GameQueries.h"
+#include "GameStandIns.h"
+#include "MockGame.h"
+#include "SpreadPatterns.h"
+#include "TechniqueLogic.h"
+#include <atomic>
+#include <cctype>
+#include <cmath>
+#include <map>
+#include <memory>
+#include <random>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// Plugin hot paths, each as the code stood before it was optimised ("Baseline")
+// next to the form the plugin runs now. The current side always calls the
+// plugin's own code, with GameQueries run on the game type stand-ins; the
+// baselines model the game calls they replaced (handle refcounts, virtual
+// calls, map building). Config reads are left out: Config needs the game.
+
+namespace {
+    namespace Baseline {
+        // BSFixedString == const char*: length check, then _strnicmp
+        bool Equals(std::string_view tag, std::string_view name)
+        {
+            if (tag.size() != name.size()) {
+                return false;
+            }
+            for (std::size_t i = 0; i < tag.size(); ++i) {
+                if (std::tolower(static_cast<unsigned char>(tag[i])) != std::tolower(static_cast<unsigned char>(name[i]))) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // Chain of compares every handler ran on every animation graph event
+        EventLog::Tag ClassifyTag(std::string_view tag)
+        {
+            if (Equals(tag, "bowDraw") || Equals(tag, "bowDrawStart")) {
+                return EventLog::Tag::BowDraw;
+            }
+            if (Equals(tag, "arrowRelease")) {
+                return EventLog::Tag::ArrowRelease;
+            }
+            if (Equals(tag, "bowDrawStop") || Equals(tag, "bowRelease") || Equals(tag, "bowUnDraw") || Equals(tag, "weaponSwing") ||
+                Equals(tag, "weaponLeftSwing")) {
+                return EventLog::Tag::BowDrawStop;
+            }
+            return EventLog::Tag::Other;
+        }
+
+        struct RuntimeTrig {
+            static double Sin(double x) { return std::sin(x); }
+            static double Cos(double x) { return std::cos(x); }
+        };
+
+        // PlayerCharacter::GetInventory: every change entry and container entry
+        // copied into a map, then one lookup
+        using InventoryMap = std::map<const StandIn::BoundObject*, std::pair<int, std::unique_ptr<StandIn::InventoryEntry>>>;
+
+        int CountItem(const std::vector<StandIn::InventoryEntry*>& changes,
+                      const std::vector<std::pair<StandIn::BoundObject*, int>>& container, const StandIn::BoundObject* object)
+        {
+            InventoryMap inventory;
+            for (auto* entry : changes) {
+                if (entry && entry->object) {
+                    inventory.try_emplace(entry->object, entry->countDelta, std::make_unique<StandIn::InventoryEntry>(*entry));
+                }
+            }
+            for (auto& [item, count] : container) {
+                auto [it, added] = inventory.try_emplace(item, 0, std::make_unique<StandIn::InventoryEntry>(StandIn::InventoryEntry{ item }));
+                if (!it->second.second->IsLeveled()) {
+                    it->second.first += count;
+                }
+            }
+            auto it = inventory.find(object);
+            return it != inventory.end() ? it->second.first : 0;
+        }
+    }
+
+    // Projectile with a virtual type check, reached through a refcounted handle table
+    struct FakeProjectile {
+        virtual ~FakeProjectile() = default;
+        virtual bool IsMissileProjectile() const { return missile; }
+        bool missile = true;
+        StandIn::Handle shooter;
+        float livingTime = 0.0f;
+    };
+
+    struct HandleTable {
+        struct Slot {
+            FakeProjectile* object = nullptr;
+            std::atomic<int> refs{ 0 };
+        };
+        std::vector<Slot> slots;
+
+        explicit HandleTable(std::size_t size) :
+            slots(size)
+        {
+        }
+
+        FakeProjectile* Acquire(StandIn::Handle handle)
+        {
+            auto& slot = slots[handle.value];
+            slot.refs.fetch_add(1, std::memory_order_acq_rel);
+            return slot.object;
+        }
+
+        void Release(StandIn::Handle handle) { slots[handle.value].refs.fetch_sub(1, std::memory_order_acq_rel); }
+    };
+
+    // Graph events of a typical shot: mostly footsteps, sounds and idles
+    std::vector<std::string_view> MakeTagStream(std::size_t count)
+    {
+        constexpr std::string_view kTags[] = {
+            "FootLeft", "FootRight", "SoundPlay", "tailCombatIdle", "bowDraw", "arrowAttach", "bowDrawStart", "FootLeft",
+            "FootRight", "SoundPlay.WPNBowNockSD", "BeginWeaponDraw", "arrowRelease", "bowReset", "FootLeft", "weaponSwing", "idleStop",
+        };
+        std::vector<std::string_view> stream(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            stream[i] = kTags[i % std::size(kTags)];
+        }
+        return stream;
+    }
+}
+
+TEST_CASE("HotPaths/AnimTagDispatch", "[!benchmark]")
+{
+    auto stream = MakeTagStream(4096);
+    for (auto tag : stream) {
+        REQUIRE(EventLog::ClassifyTag(tag) == Baseline::ClassifyTag(tag));
+    }
+
+    BENCHMARK("Baseline compare chain x4096")
+    {
+        int hits = 0;
+        for (auto tag : stream) {
+            hits += Baseline::ClassifyTag(tag) != EventLog::Tag::Other;
+        }
+        return hits;
+    };
+    BENCHMARK("Length switch x4096")
+    {
+        int hits = 0;
+        for (auto tag : stream) {
+            hits += EventLog::ClassifyTag(tag) != EventLog::Tag::Other;
+        }
+        return hits;
+    };
+}
+
+TEST_CASE("HotPaths/InputEventFiltering", "[!benchmark]")
+{
+    // Four frames of VR input, 12 batches a frame: controller axes, mouse
+    // look and buttons of other devices, with the activation key held
+    constexpr std::uint32_t kKey = 0x2E;
+    constexpr int kFrames = 4;
+    constexpr int kBatchesPerFrame = 12;
+    std::vector<StandIn::InputEvent> events(6);
+    for (std::size_t i = 0; i < events.size(); ++i) {
+        events[i].type = i % 3 == 0 ? StandIn::EventType::kButton : StandIn::EventType::kThumbstick;
+        events[i].device = i % 2 == 0 ? StandIn::Device::kVRRight : StandIn::Device::kKeyboard;
+        events[i].idCode = i == 3 ? kKey : static_cast<std::uint32_t>(i);
+        events[i].value = 1.0f;
+        events[i].heldDownSecs = 0.2f;
+    }
+    auto* chain = StandIn::Link(events);
+
+    MockGame game;
+    MultishotConfig multishotConfig;
+    PenetratingArrowConfig penetratingConfig;
+    MultishotLogic multishot(game, multishotConfig);
+    PenetratingLogic penetrating(game, penetratingConfig, multishot);
+
+    // The key filter is unchanged and runs on every batch in both; the frame gate is what differs
+    BENCHMARK("Baseline update per input batch")
+    {
+        int pressed = 0;
+        for (int frame = 0; frame < kFrames; ++frame) {
+            for (int batch = 0; batch < kBatchesPerFrame; ++batch) {
+                pressed += GameQueries::FindKeyPress<StandIn::EventType::kButton, StandIn::Device::kKeyboard>(chain, kKey) != nullptr;
+                penetrating.Update();
+            }
+        }
+        return pressed;
+    };
+    BENCHMARK("FrameGate once per frame")
+    {
+        int pressed = 0;
+        FrameGate gate;
+        for (std::uint64_t frame = 0; frame < kFrames; ++frame) {
+            for (int batch = 0; batch < kBatchesPerFrame; ++batch) {
+                pressed += GameQueries::FindKeyPress<StandIn::EventType::kButton, StandIn::Device::kKeyboard>(chain, kKey) != nullptr;
+                if (gate.Enter(frame)) {
+                    penetrating.Update();
+                }
+            }
+        }
+        return pressed;
+    };
+}
+
+TEST_CASE("HotPaths/SpreadGeneration", "[!benchmark]")
+{
+    // One full-size volley's extra arrows: same slots, same outputs on both sides
+    constexpr auto kPattern = SpreadPatterns::Pattern::Cone;
+    constexpr int kArrows = SpreadPatterns::kMaxArrows;
+    auto basis = SpreadPatterns::MakeAimBasis(0.1f, 1.2f);
+    float tanSpread = std::tan(FastTrig::ToRadians(15.0f));
+
+    auto angleSum = [&](auto offsetOf) {
+        float sum = 0.0f;
+        for (int slot = 1; slot < kArrows; ++slot) {
+            float direction[3];
+            float pitch = 0.0f;
+            float yaw = 0.0f;
+            SpreadPatterns::ApplyOffset(basis, tanSpread, offsetOf(slot), direction);
+            SpreadPatterns::DirectionToAngles(direction, pitch, yaw);
+            sum += pitch + yaw;
+        }
+        return sum;
+    };
+    auto runtimeTrig = [](int slot) { return SpreadPatterns::ComputeOffset<Baseline::RuntimeTrig>(kPattern, kArrows, slot); };
+    auto table = [] {
+        const auto& offsets = SpreadPatterns::GetTable(kPattern, kArrows);
+        return [&offsets](int slot) { return offsets[slot]; };
+    };
+    REQUIRE(angleSum(table()) == Catch::Approx(angleSum(runtimeTrig)));
+
+    BENCHMARK("Baseline runtime trig per arrow")
+    {
+        return angleSum(runtimeTrig);
+    };
+    BENCHMARK("Precomputed table per arrow")
+    {
+        return angleSum(table());
+    };
+}
+
+TEST_CASE("HotPaths/RecentProjectileLookup", "[!benchmark]")
+{
+    // A busy battle: 200 live projectiles, a handful from the player
+    constexpr StandIn::Handle kPlayer{ 1 };
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<float> age(0.0f, 5.0f);
+
+    std::vector<FakeProjectile> objects(200);
+    HandleTable table(objects.size() + 16);
+    std::vector<StandIn::Handle> projectiles;
+    for (std::size_t i = 0; i < objects.size(); ++i) {
+        objects[i].shooter = i % 25 == 0 ? kPlayer : StandIn::Handle{ static_cast<std::uint32_t>(2 + i % 14) };
+        objects[i].livingTime = age(rng);
+        objects[i].missile = i % 10 != 5;
+        StandIn::Handle handle{ static_cast<std::uint32_t>(16 + i) };
+        table.slots[handle.value].object = &objects[i];
+        projectiles.push_back(handle);
+    }
+    FakeProjectile playerObject;
+    table.slots[kPlayer.value].object = &playerObject;
+
+    // The plugin's old loop: type check first, then resolve the shooter and compare pointers
+    auto baseline = [&] {
+        FakeProjectile* newest = nullptr;
+        float shortest = 0.5f;
+        for (auto handle : projectiles) {
+            auto* projectile = table.Acquire(handle);
+            if (projectile && projectile->IsMissileProjectile()) {
+                auto* shooter = table.Acquire(projectile->shooter);
+                if (shooter == &playerObject && projectile->livingTime < shortest) {
+                    newest = projectile;
+                    shortest = projectile->livingTime;
+                }
+                table.Release(projectile->shooter);
+            }
+            table.Release(handle);
+        }
+        return newest;
+    };
+    auto current = [&] {
+        FakeProjectile* newest = nullptr;
+        float shortest = 0.5f;
+        for (auto handle : projectiles) {
+            auto* projectile = table.Acquire(handle);
+            if (projectile && GameQueries::IsNewerPlayerArrow(projectile->livingTime, shortest, projectile->shooter, kPlayer,
+                                                              [projectile] { return projectile->IsMissileProjectile(); })) {
+                newest = projectile;
+                shortest = projectile->livingTime;
+            }
+            table.Release(handle);
+        }
+        return newest;
+    };
+    REQUIRE(current() == baseline());
+
+    BENCHMARK("Baseline resolve shooter of every missile")
+    {
+        return baseline();
+    };
+    BENCHMARK("IsNewerPlayerArrow")
+    {
+        return current();
+    };
+}
+
+TEST_CASE("HotPaths/AmmoCount", "[!benchmark]")
+{
+    // A looted-dungeon inventory: 300 changed items over a 40-item base container
+    std::vector<StandIn::BoundObject> objects(340);
+    std::vector<StandIn::InventoryEntry> entryData(300);
+    std::vector<StandIn::InventoryEntry*> changes;
+    std::vector<std::pair<StandIn::BoundObject*, int>> container;
+    for (std::size_t i = 0; i < objects.size(); ++i) {
+        objects[i].formID = static_cast<std::uint32_t>(0x1000 + i);
+    }
+    for (std::size_t i = 0; i < entryData.size(); ++i) {
+        entryData[i] = { &objects[i], static_cast<std::int32_t>(i % 7 + 1) };
+        changes.push_back(&entryData[i]);
+    }
+    for (std::size_t i = 0; i < 40; ++i) {
+        container.emplace_back(&objects[i * 8 + 20], static_cast<int>(i % 3 + 1));
+    }
+    const auto* ammo = &objects[124];  // changed, and also in the base container
+
+    // TESContainer::CountObjectsInContainer walks the base container
+    auto baseCount = [&] {
+        int count = 0;
+        for (auto& [item, itemCount] : container) {
+            count += item == ammo ? itemCount : 0;
+        }
+        return count;
+    };
+    REQUIRE(GameQueries::CountItem(changes, ammo, baseCount) == Baseline::CountItem(changes, container, ammo));
+
+    BENCHMARK("Baseline whole inventory map")
+    {
+        return Baseline::CountItem(changes, container, ammo);
+    };
+    BENCHMARK("CountItem on the change entries")
+    {
+        return GameQueries::CountItem(changes, ammo, baseCount);
+    };
+}
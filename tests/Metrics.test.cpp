@@ -0,0 +1,123 @@
+#include "catch2/catch_all.hpp"
+
+#include "Metrics.h"
+#include <random>
+#include <thread>
+#include <vector>
+
+TEST_CASE("Metrics/BucketsCoverEveryValue")
+{
+    // Small values are exact
+    for (std::uint64_t value = 0; value < LatencyHistogram::kSubBuckets; ++value) {
+        CHECK(LatencyHistogram::BucketIndex(value) == static_cast<int>(value));
+    }
+
+    // Every value lands in a bucket whose upper bound is within 12.5% above it
+    std::mt19937_64 rng(7);
+    for (int i = 0; i < 10000; ++i) {
+        std::uint64_t value = rng() >> (rng() % 40 + 24);
+        int index = LatencyHistogram::BucketIndex(value);
+        REQUIRE(index >= 0);
+        REQUIRE(index < LatencyHistogram::kBucketCount);
+        auto upper = LatencyHistogram::BucketUpperBound(index);
+        CHECK(upper >= value);
+        CHECK(static_cast<double>(upper - value) <= static_cast<double>(value) * 0.125);
+        if (index > 0) {
+            CHECK(LatencyHistogram::BucketUpperBound(index - 1) < value);
+        }
+    }
+
+    // Anything past the range is clamped into the last bucket
+    CHECK(LatencyHistogram::BucketIndex(~0ull) == LatencyHistogram::kBucketCount - 1);
+}
+
+TEST_CASE("Metrics/Percentiles")
+{
+    LatencyHistogram histogram;
+    CHECK(histogram.Summarize().count == 0);
+    CHECK(histogram.Percentile(0.5) == 0);
+
+    // 1..1000 us
+    for (std::uint64_t i = 1; i <= 1000; ++i) {
+        histogram.Record(i * 1000);
+    }
+    auto summary = histogram.Summarize();
+    CHECK(summary.count == 1000);
+    CHECK(summary.mean == 500500);
+    CHECK(summary.max == 1000000);
+    CHECK(summary.p50 == Catch::Approx(500000).epsilon(0.125));
+    CHECK(summary.p90 == Catch::Approx(900000).epsilon(0.125));
+    CHECK(summary.p99 == Catch::Approx(990000).epsilon(0.125));
+    CHECK(summary.p99 <= summary.max);
+
+    histogram.Reset();
+    CHECK(histogram.Count() == 0);
+    CHECK(histogram.Summarize().max == 0);
+}
+
+TEST_CASE("Metrics/ConcurrentRecording")
+{
+    LatencyHistogram histogram;
+    constexpr int kThreads = 4;
+    constexpr int kPerThread = 20000;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&histogram, t] {
+            for (int i = 0; i < kPerThread; ++i) {
+                histogram.Record(static_cast<std::uint64_t>(t * kPerThread + i));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    CHECK(histogram.Count() == kThreads * kPerThread);
+    CHECK(histogram.Summarize().max == kThreads * kPerThread - 1);
+}
+
+TEST_CASE("Metrics/Report")
+{
+    auto* metrics = Metrics::GetSingleton();
+    metrics->Reset();
+
+    metrics->Record(Metrics::Stage::ReleaseToLaunch, 35000);
+    metrics->Increment(Metrics::Counter::Volleys);
+    metrics->Increment(Metrics::Counter::ArrowsLaunched, 4);
+    {
+        Metrics::ScopedTimer timer(Metrics::Stage::Frame);
+    }
+    CHECK(metrics->Histogram(Metrics::Stage::Frame).Count() == 1);
+    CHECK(metrics->Get(Metrics::Counter::ArrowsLaunched) == 4);
+
+    auto line = metrics->FormatLine();
+    CHECK(line.find("releaseToLaunch n=1 p50=35.0us") != std::string::npos);
+    CHECK(line.find("penetratingFind n=0 |") != std::string::npos);
+    CHECK(line.find("volleys=1 arrowsLaunched=4") != std::string::npos);
+
+    auto report = metrics->FormatReport();
+    REQUIRE(report.size() == static_cast<std::size_t>(Metrics::Stage::kCount) + 1);
+    CHECK(report.front().find("mean=35.0us") != std::string::npos);
+    CHECK(report.back().rfind("animEvents=0", 0) == 0);
+
+    metrics->Reset();
+    CHECK(metrics->Get(Metrics::Counter::Volleys) == 0);
+}
+
+TEST_CASE("Metrics/Benchmark", "[!benchmark]")
+{
+    LatencyHistogram histogram;
+    std::uint64_t value = 1;
+
+    BENCHMARK("Record")
+    {
+        value = value * 6364136223846793005ull + 1442695040888963407ull;
+        histogram.Record(value >> 44);
+        return histogram.Count();
+    };
+    BENCHMARK("Summarize")
+    {
+        return histogram.Summarize().p99;
+    };
+}
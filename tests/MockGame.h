@@ -0,0 +1,91 @@
+#pragma once
+
+#include "GameFacade.h"
+#include "TechniqueLogic.h"
+#include <array>
+#include <cstddef>
+
+// ============================================
+// Mock game
+// ============================================
+// Game::Facade with a fake player, inventory, projectile manager and clock.
+// Launches take ammo from the inventory the way the plugin's volley does and
+// are counted; reports are tallied per event so tests can assert on them.
+// With computeVolleys set, volleys run through Volley::Fire exactly as the
+// plugin's, with the mock standing in for the projectile launcher.
+class MockGame : public Game::Facade, public Volley::Launcher
+{
+public:
+    // Fake player and inventory
+    Game::Shooter shooter{ true, false, false, true, true };
+    bool multishotPerk = true;
+    bool penetratingPerk = true;
+    int ammo = 100;
+    std::uint32_t playerID = 0x14;
+
+    // Fake VR draw tracker
+    bool drawTracked = false;
+    bool drawing = false;
+
+    // Fake clock
+    double now = 0.0;
+    void Advance(double seconds) { now += seconds; }
+
+    // Fake projectile manager
+    int volleys = 0;
+    int arrowsLaunched = 0;
+    int penetratingShots = 0;
+    MultishotConfig volleyConfig;
+    Volley::Layout lastVolley;
+    bool computeVolleys = false; // lay out and launch each volley like the plugin does
+
+    std::array<int, 32> reports{};
+    float lastReportValue = 0.0f;
+    int Reported(Game::Event event) const { return reports[static_cast<std::size_t>(event)]; }
+
+    double GameTime() const override { return now; }
+    Game::Shooter GetShooter() const override { return shooter; }
+    std::uint32_t PlayerID() const override { return playerID; }
+    bool MeetsPerkRequirement(Game::Technique technique) const override
+    {
+        return technique == Game::Technique::Multishot ? multishotPerk : penetratingPerk;
+    }
+    int AmmoCount() const override { return ammo; }
+    bool IsDrawTracked() const override { return drawTracked; }
+    bool IsDrawing() const override { return drawing; }
+
+    void LaunchVolley(int arrowCount, int additionalArrows) override
+    {
+        ++volleys;
+        if (!computeVolleys) {
+            arrowsLaunched += additionalArrows;
+            ammo -= additionalArrows;
+            return;
+        }
+
+        Volley::Input input;
+        input.cameraRight[0] = 1.0f;
+        input.cameraUp[2] = 1.0f;
+        input.arrowCount = arrowCount;
+        input.projectileSpeed = 6000.0f;
+        input.projectileGravity = 686.6f;
+        auto result = Volley::Fire(input, volleyConfig, *this);
+        lastVolley = result.layout;
+        ammo -= result.launched;
+    }
+
+    // Fake projectile launch
+    bool Launch(int, const std::array<float, 3>&, float, float) override
+    {
+        ++arrowsLaunched;
+        return true;
+    }
+
+    void LaunchPenetratingArrow() override { ++penetratingShots; }
+
+    void Report(Game::Event event, float value) override
+    {
+        ++reports[static_cast<std::size_t>(event)];
+        lastReportValue = value;
+    }
+};
@@ -0,0 +1,103 @@
+#include "catch2/catch_all.hpp"
+
+#include "Metrics.h"
+#include "NotificationQueue.h"
+#include <chrono>
+#include <string>
+#include <string_view>
+
+namespace {
+    using Channel = NotificationQueue::Channel;
+    using namespace std::chrono_literals;
+
+    const GameClock::RealTime kStart = GameClock::RealTime{} + 100s;
+}
+
+TEST_CASE("NotificationQueue/FirstMessageShowsImmediately")
+{
+    NotificationQueue queue;
+    queue.Post(Channel::Multishot, "Multishot: READY");
+
+    auto batch = queue.TakeDue(kStart, 1.0f);
+    REQUIRE(batch.count == 1);
+    CHECK(std::string_view(batch.messages[0].data()) == "Multishot: READY");
+    CHECK(queue.TakeDue(kStart, 1.0f).count == 0);
+}
+
+TEST_CASE("NotificationQueue/BurstCoalescesToTheLatest")
+{
+    auto* metrics = Metrics::GetSingleton();
+    metrics->Reset();
+
+    NotificationQueue queue;
+    queue.Post(Channel::Multishot, "Multishot: Cooldown (9s)");
+    REQUIRE(queue.TakeDue(kStart, 1.0f).count == 1);
+
+    // Mashing the key inside the interval keeps only the last state
+    queue.Post(Channel::Multishot, "Multishot: Cooldown (9s)");
+    queue.Post(Channel::Multishot, "Multishot: Cooldown (8s)");
+    queue.Post(Channel::Multishot, "Multishot: Cooldown (8s)");
+    CHECK(queue.TakeDue(kStart + 500ms, 1.0f).count == 0);
+
+    auto batch = queue.TakeDue(kStart + 1s, 1.0f);
+    REQUIRE(batch.count == 1);
+    CHECK(std::string_view(batch.messages[0].data()) == "Multishot: Cooldown (8s)");
+
+    CHECK(metrics->Get(Metrics::Counter::NotificationsShown) == 2);
+    CHECK(metrics->Get(Metrics::Counter::NotificationsSuppressed) == 2);
+    metrics->Reset();
+}
+
+TEST_CASE("NotificationQueue/RepeatsOfTheShownMessageAreDropped")
+{
+    NotificationQueue queue;
+    queue.Post(Channel::Multishot, "Multishot: Already READY");
+    REQUIRE(queue.TakeDue(kStart, 1.0f).count == 1);
+
+    queue.Post(Channel::Multishot, "Multishot: Already READY");
+    CHECK(queue.TakeDue(kStart + 200ms, 1.0f).count == 0);
+    // Dropped, not deferred
+    CHECK(queue.TakeDue(kStart + 2s, 1.0f).count == 0);
+
+    // Once the interval is up the same text may show again
+    queue.Post(Channel::Multishot, "Multishot: Already READY");
+    CHECK(queue.TakeDue(kStart + 3s, 1.0f).count == 1);
+}
+
+TEST_CASE("NotificationQueue/ChannelsAreThrottledSeparately")
+{
+    NotificationQueue queue;
+    queue.Post(Channel::PenetratingArrow, "Penetrating Arrow: Cooldown (5s)");
+    queue.Post(Channel::Multishot, "Multishot: READY");
+
+    auto batch = queue.TakeDue(kStart, 1.0f);
+    REQUIRE(batch.count == 2);
+    CHECK(std::string_view(batch.messages[0].data()) == "Multishot: READY");
+    CHECK(std::string_view(batch.messages[1].data()) == "Penetrating Arrow: Cooldown (5s)");
+
+    queue.Post(Channel::Multishot, "Multishot: Expired");
+    CHECK(queue.TakeDue(kStart + 100ms, 1.0f).count == 0);
+    queue.Post(Channel::PenetratingArrow, "Penetrating Arrow: Cooldown (4s)");
+    batch = queue.TakeDue(kStart + 1s, 1.0f);
+    CHECK(batch.count == 2);
+}
+
+TEST_CASE("NotificationQueue/ZeroIntervalShowsEveryFrame")
+{
+    NotificationQueue queue;
+    for (int frame = 0; frame < 3; ++frame) {
+        queue.Post(Channel::Multishot, frame % 2 ? "Multishot: READY" : "Multishot: Expired");
+        CHECK(queue.TakeDue(kStart, 0.0f).count == 1);
+    }
+}
+
+TEST_CASE("NotificationQueue/LongTextIsTruncated")
+{
+    NotificationQueue queue;
+    std::string text(NotificationQueue::kMaxLength + 20, 'x');
+    queue.Post(Channel::Multishot, text);
+
+    auto batch = queue.TakeDue(kStart, 1.0f);
+    REQUIRE(batch.count == 1);
+    CHECK(std::string_view(batch.messages[0].data()).size() == NotificationQueue::kMaxLength);
+}
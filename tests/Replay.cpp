@@ -0,0 +1,123 @@
+// Replays a recorded ArcheryTechniques.events file against the mock game and
+// reports divergences and per-frame / per-shot cost of the technique logic.
+//
+//   ArcheryTechniquesReplay <events file> [repeats]
+
+#include "EventLog.h"
+#include "EventReplay.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    double Nanoseconds(Clock::duration duration)
+    {
+        return std::chrono::duration<double, std::nano>(duration).count();
+    }
+
+    const char* ToString(MultishotState state)
+    {
+        switch (state) {
+        case MultishotState::Inactive:
+            return "Inactive";
+        case MultishotState::Ready:
+            return "Ready";
+        case MultishotState::Cooldown:
+            return "Cooldown";
+        }
+        return "?";
+    }
+
+    const char* ToString(PenetratingArrowState state)
+    {
+        switch (state) {
+        case PenetratingArrowState::Inactive:
+            return "Inactive";
+        case PenetratingArrowState::Drawing:
+            return "Drawing";
+        case PenetratingArrowState::Charging:
+            return "Charging";
+        case PenetratingArrowState::Charged:
+            return "Charged";
+        case PenetratingArrowState::Cooldown:
+            return "Cooldown";
+        }
+        return "?";
+    }
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2) {
+        std::fprintf(stderr, "usage: %s <events file> [repeats]\n", argv[0]);
+        return 2;
+    }
+    int repeats = argc > 2 ? std::max(1, std::atoi(argv[2])) : 20;
+
+    EventLog::Header header;
+    std::vector<EventLog::Record> records;
+    if (!EventLog::Read(argv[1], header, records)) {
+        std::fprintf(stderr, "%s is not an event log of version %u\n", argv[1], EventLog::kVersion);
+        return 2;
+    }
+
+    // Verification pass: every checkpoint must match
+    EventReplay verify(header);
+    verify.Run(records);
+    double sessionSeconds = verify.GetGame().now;
+    std::printf("%zu records, %zu frames, %.1fs of play, %zu launches\n", records.size(), verify.Frames(), sessionSeconds, verify.Launches());
+
+    for (const auto& divergence : verify.Divergences()) {
+        std::printf("  divergence at record %zu: multishot %s (recorded %s), penetrating %s (recorded %s)\n", divergence.record,
+                    ToString(divergence.actualMultishot), ToString(divergence.expectedMultishot), ToString(divergence.actualPenetrating),
+                    ToString(divergence.expectedPenetrating));
+    }
+    std::printf("%zu divergences\n", verify.DivergenceCount());
+
+    // Throughput: whole session, repeated
+    auto start = Clock::now();
+    for (int i = 0; i < repeats; ++i) {
+        EventReplay replay(header);
+        replay.Run(records);
+    }
+    double total = Nanoseconds(Clock::now() - start) / repeats;
+
+    // Per-frame and per-shot cost from one timed pass
+    EventReplay timed(header);
+    double worstFrame = 0.0;
+    double releaseTotal = 0.0;
+    std::size_t releases = 0;
+    auto frameStart = Clock::now();
+    for (const auto& record : records) {
+        if (record.type == EventLog::Type::Frame) {
+            auto now = Clock::now();
+            worstFrame = std::max(worstFrame, Nanoseconds(now - frameStart));
+            frameStart = now;
+        }
+
+        bool release = record.type == EventLog::Type::AnimTag && static_cast<EventLog::Tag>(record.data) == EventLog::Tag::ArrowRelease;
+        if (!release) {
+            timed.Step(record);
+            continue;
+        }
+        auto launches = timed.Launches();
+        auto releaseStart = Clock::now();
+        timed.Step(record);
+        auto elapsed = Nanoseconds(Clock::now() - releaseStart);
+        if (timed.Launches() > launches) {
+            releaseTotal += elapsed;
+            ++releases;
+        }
+    }
+
+    std::printf("replay: %.0f ns per session (x%.0f real time), %.1f ns per record\n", total,
+                total > 0.0 ? sessionSeconds * 1.0e9 / total : 0.0, records.empty() ? 0.0 : total / static_cast<double>(records.size()));
+    std::printf("per frame: %.1f ns mean, %.0f ns worst\n", verify.Frames() ? total / static_cast<double>(verify.Frames()) : 0.0, worstFrame);
+    std::printf("release-to-launch: %.1f ns per shot over %zu shots\n", releases ? releaseTotal / static_cast<double>(releases) : 0.0, releases);
+
+    return verify.DivergenceCount() == 0 ? 0 : 1;
+}
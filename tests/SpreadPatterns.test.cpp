@@ -0,0 +1,93 @@
+#include "catch2/catch_all.hpp"
+
+#include "SpreadPatterns.h"
+#include <cmath>
+#include <numbers>
+
+namespace {
+    struct RuntimeTrig {
+        static double Sin(double x) { return std::sin(x); }
+        static double Cos(double x) { return std::cos(x); }
+    };
+
+    constexpr SpreadPatterns::Pattern kAllPatterns[] = {
+        SpreadPatterns::Pattern::Fan,
+        SpreadPatterns::Pattern::Vertical,
+        SpreadPatterns::Pattern::Cone,
+        SpreadPatterns::Pattern::Ring,
+        SpreadPatterns::Pattern::Cross,
+    };
+}
+
+// The tables must be usable in constant expressions
+static_assert(SpreadPatterns::GetTable(SpreadPatterns::Pattern::Fan, 3)[1].right == -1.0f);
+static_assert(SpreadPatterns::GetTable(SpreadPatterns::Pattern::Fan, 3)[2].right == 1.0f);
+static_assert(SpreadPatterns::GetTable(SpreadPatterns::Pattern::Ring, 5)[1].up == 1.0f);
+
+TEST_CASE("SpreadPatterns/ConstexprTablesMatchRuntimeTrig")
+{
+    for (auto pattern : kAllPatterns) {
+        for (int count = SpreadPatterns::kMinArrows; count <= SpreadPatterns::kMaxArrows; ++count) {
+            const auto& table = SpreadPatterns::GetTable(pattern, count);
+            for (int slot = 0; slot < SpreadPatterns::kMaxArrows; ++slot) {
+                auto expected = SpreadPatterns::ComputeOffset<RuntimeTrig>(pattern, count, slot);
+                INFO("pattern " << SpreadPatterns::ToString(pattern) << ", count " << count << ", slot " << slot);
+                CHECK(table[slot].right == Catch::Approx(expected.right).margin(1.0e-6));
+                CHECK(table[slot].up == Catch::Approx(expected.up).margin(1.0e-6));
+            }
+        }
+    }
+}
+
+TEST_CASE("SpreadPatterns/VanillaSlotIsCentered")
+{
+    for (auto pattern : kAllPatterns) {
+        for (int count = SpreadPatterns::kMinArrows; count <= SpreadPatterns::kMaxArrows; ++count) {
+            const auto& slot = SpreadPatterns::GetTable(pattern, count)[0];
+            CHECK(slot.right == 0.0f);
+            CHECK(slot.up == 0.0f);
+        }
+    }
+}
+
+TEST_CASE("SpreadPatterns/FanMatchesYawSpread")
+{
+    constexpr float spread = 15.0f * std::numbers::pi_v<float> / 180.0f;
+    const auto basis = SpreadPatterns::MakeAimBasis(0.0f, 0.3f);
+    const auto& table = SpreadPatterns::GetTable(SpreadPatterns::Pattern::Fan, 5);
+
+    for (int slot = 1; slot < 5; ++slot) {
+        float direction[3];
+        float pitch, yaw;
+        SpreadPatterns::ApplyOffset(basis, std::tan(spread), table[slot], direction);
+        SpreadPatterns::DirectionToAngles(direction, pitch, yaw);
+
+        CHECK(pitch == Catch::Approx(0.0f).margin(1.0e-6));
+        CHECK(yaw == Catch::Approx(0.3f + std::atan(table[slot].right * std::tan(spread))));
+    }
+}
+
+TEST_CASE("SpreadPatterns/AimBasisIsOrthonormal")
+{
+    const auto basis = SpreadPatterns::MakeAimBasis(-0.4f, 2.1f);
+    auto dot = [](const float (&a)[3], const float (&b)[3]) { return a[0] * b[0] + a[1] * b[1] + a[2] * b[2]; };
+
+    CHECK(dot(basis.right, basis.right) == Catch::Approx(1.0f));
+    CHECK(dot(basis.forward, basis.forward) == Catch::Approx(1.0f));
+    CHECK(dot(basis.up, basis.up) == Catch::Approx(1.0f));
+    CHECK(dot(basis.right, basis.forward) == Catch::Approx(0.0f).margin(1.0e-6));
+    CHECK(dot(basis.right, basis.up) == Catch::Approx(0.0f).margin(1.0e-6));
+    CHECK(dot(basis.forward, basis.up) == Catch::Approx(0.0f).margin(1.0e-6));
+
+    float pitch, yaw;
+    SpreadPatterns::DirectionToAngles(basis.forward, pitch, yaw);
+    CHECK(pitch == Catch::Approx(-0.4f));
+    CHECK(yaw == Catch::Approx(2.1f));
+}
+
+TEST_CASE("SpreadPatterns/FromString")
+{
+    CHECK(SpreadPatterns::FromString("Ring") == SpreadPatterns::Pattern::Ring);
+    CHECK(SpreadPatterns::FromString("CROSS") == SpreadPatterns::Pattern::Cross);
+    CHECK(SpreadPatterns::FromString("spiral", SpreadPatterns::Pattern::Cone) == SpreadPatterns::Pattern::Cone);
+}
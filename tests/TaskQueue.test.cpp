@@ -0,0 +1,185 @@
+#include "catch2/catch_all.hpp"
+
+#include "Metrics.h"
+#include "TaskQueue.h"
+#include <array>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+TEST_CASE("TaskQueue/RunsInOrderOncePerDrain")
+{
+    TaskQueue queue;
+    std::vector<int> ran;
+
+    for (int i = 0; i < 5; ++i) {
+        REQUIRE(queue.Push([&ran, i] { ran.push_back(i); }));
+    }
+    CHECK(queue.Depth() == 5);
+    CHECK(ran.empty());
+
+    CHECK(queue.Drain() == 5);
+    CHECK(ran == std::vector<int>{ 0, 1, 2, 3, 4 });
+    CHECK(queue.Depth() == 0);
+    CHECK(queue.PeakDepth() == 5);
+    CHECK(queue.Drain() == 0);
+}
+
+TEST_CASE("TaskQueue/RequeuedTasksWaitForTheNextDrain")
+{
+    TaskQueue queue;
+    int attempts = 0;
+
+    struct Retry {
+        TaskQueue* queue;
+        int* attempts;
+        void operator()() const
+        {
+            if (++*attempts < 3) {
+                queue->Push(*this);
+            }
+        }
+    };
+
+    queue.Push(Retry{ &queue, &attempts });
+    CHECK(queue.Drain() == 1);
+    CHECK(attempts == 1);
+    CHECK(queue.Drain() == 1);
+    CHECK(queue.Drain() == 1);
+    CHECK(attempts == 3);
+    CHECK(queue.Drain() == 0);
+}
+
+TEST_CASE("TaskQueue/FullRingLeavesTheTaskWithTheCaller")
+{
+    TaskQueue queue;
+    for (std::size_t i = 0; i < TaskQueue::kCapacity; ++i) {
+        REQUIRE(queue.Push([] {}));
+    }
+
+    auto owned = std::make_shared<int>(7);
+    auto task = [owned] {};
+    CHECK(!queue.Push(std::move(task)));
+    CHECK(owned.use_count() == 2);
+
+    CHECK(queue.Drain() == TaskQueue::kCapacity);
+    CHECK(queue.Push(std::move(task)));
+    CHECK(queue.Drain() == 1);
+}
+
+TEST_CASE("TaskQueue/LargeCapturesAndDestruction")
+{
+    auto* metrics = Metrics::GetSingleton();
+    metrics->Reset();
+
+    auto owned = std::make_shared<int>(0);
+    {
+        TaskQueue queue;
+        std::array<char, TaskQueue::kInlineBytes * 2> big{};
+        big[0] = 1;
+        queue.Push([owned, big] { *owned += big[0]; });
+        queue.Push([owned] { *owned += 10; });
+        CHECK(owned.use_count() == 3);
+        CHECK(metrics->Get(Metrics::Counter::TasksBoxed) == 1);
+
+        CHECK(queue.Drain() == 2);
+        CHECK(*owned == 11);
+        CHECK(owned.use_count() == 1);
+
+        // Still pending when the queue goes away: destroyed, never run
+        queue.Push([owned] { *owned += 100; });
+    }
+    CHECK(*owned == 11);
+    CHECK(owned.use_count() == 1);
+    metrics->Reset();
+}
+
+TEST_CASE("TaskQueue/ManyProducersOneConsumer")
+{
+    TaskQueue queue;
+    constexpr int kThreads = 4;
+    constexpr int kPerThread = 5000;
+
+    std::array<std::vector<int>, kThreads> seen;
+    std::atomic<int> pushed{ 0 };
+    std::vector<std::thread> producers;
+    for (int t = 0; t < kThreads; ++t) {
+        producers.emplace_back([&, t] {
+            for (int i = 0; i < kPerThread; ++i) {
+                while (!queue.Push([&seen, t, i] { seen[t].push_back(i); })) {
+                    std::this_thread::yield();
+                }
+                pushed.fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+    }
+
+    std::size_t ran = 0;
+    while (ran < static_cast<std::size_t>(kThreads * kPerThread)) {
+        ran += queue.Drain();
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+
+    // Each producer's tasks run exactly once and in the order it pushed them
+    for (const auto& values : seen) {
+        REQUIRE(values.size() == static_cast<std::size_t>(kPerThread));
+        for (int i = 0; i < kPerThread; ++i) {
+            REQUIRE(values[i] == i);
+        }
+    }
+    CHECK(queue.PeakDepth() <= TaskQueue::kCapacity);
+}
+
+TEST_CASE("TaskQueue/RecordsDrainTime")
+{
+    auto* metrics = Metrics::GetSingleton();
+    metrics->Reset();
+
+    TaskQueue queue;
+    queue.Drain();
+    CHECK(metrics->Histogram(Metrics::Stage::TaskDrain).Count() == 0);
+
+    queue.Push([] {});
+    queue.Push([] {});
+    queue.Drain();
+    CHECK(metrics->Histogram(Metrics::Stage::TaskDrain).Count() == 1);
+    CHECK(metrics->Get(Metrics::Counter::TasksQueued) == 2);
+    metrics->Reset();
+}
+
+TEST_CASE("TaskQueue/Benchmark", "[!benchmark]")
+{
+    // Stand-in for SKSE's AddTask: a heap-allocated delegate per task behind a lock
+    std::mutex lock;
+    std::deque<std::unique_ptr<std::function<void()>>> delegates;
+    TaskQueue queue;
+    void* player = &lock;
+    int sum = 0;
+
+    BENCHMARK("Heap delegate push + run")
+    {
+        for (int i = 0; i < 8; ++i) {
+            std::lock_guard guard(lock);
+            delegates.push_back(std::make_unique<std::function<void()>>([player, i, &sum] { sum += i + (player != nullptr); }));
+        }
+        std::lock_guard guard(lock);
+        for (auto& delegate : delegates) {
+            (*delegate)();
+        }
+        delegates.clear();
+        return sum;
+    };
+    BENCHMARK("TaskQueue push + drain")
+    {
+        for (int i = 0; i < 8; ++i) {
+            queue.Push([player, i, &sum] { sum += i + (player != nullptr); });
+        }
+        queue.Drain();
+        return sum;
+    };
+}
@@ -0,0 +1,280 @@
+#include "catch2/catch_all.hpp"
+
+#include "MockGame.h"
+#include "TechniqueLogic.h"
+#include <cmath>
+
+namespace {
+    using Game::Event;
+
+    struct Harness {
+        MockGame game;
+        MultishotConfig multishotConfig;
+        PenetratingArrowConfig penetratingConfig;
+        MultishotLogic multishot{ game, multishotConfig };
+        PenetratingLogic penetrating{ game, penetratingConfig, multishot };
+    };
+}
+
+TEST_CASE("TechniqueLogic/MultishotReadyWindowExpires")
+{
+    Harness h;
+    REQUIRE(h.multishot.TryActivate());
+    CHECK(h.multishot.IsReady());
+    CHECK(h.game.Reported(Event::MultishotReady) == 1);
+
+    h.game.Advance(h.multishotConfig.readyWindowDuration - 1.0);
+    h.multishot.Update();
+    CHECK(h.multishot.GetRemainingReadyTime() == Catch::Approx(1.0f));
+
+    h.game.Advance(1.0);
+    h.multishot.Update();
+    CHECK(h.multishot.GetState() == MultishotState::Inactive);
+    CHECK(h.game.Reported(Event::MultishotExpired) == 1);
+
+    // A release after the window is a normal shot
+    CHECK_FALSE(h.multishot.OnArrowRelease());
+    CHECK(h.game.volleys == 0);
+}
+
+TEST_CASE("TechniqueLogic/MultishotVolleyStartsCooldown")
+{
+    Harness h;
+    h.multishotConfig.arrowCount = 5;
+    REQUIRE(h.multishot.TryActivate());
+
+    CHECK(h.multishot.OnArrowRelease());
+    CHECK(h.game.volleys == 1);
+    CHECK(h.game.arrowsLaunched == 4);
+    CHECK(h.game.ammo == 96);
+    CHECK(h.multishot.IsOnCooldown());
+
+    // Cooldown blocks the key until it has run out
+    CHECK_FALSE(h.multishot.TryActivate());
+    h.game.Advance(h.multishotConfig.cooldownDuration);
+    CHECK(h.multishot.TryActivate());
+    CHECK(h.game.Reported(Event::MultishotCooldownFinished) == 1);
+}
+
+TEST_CASE("TechniqueLogic/MultishotNeedsAmmoAndBow")
+{
+    Harness h;
+    h.game.shooter.hasBow = false;
+    CHECK_FALSE(h.multishot.TryActivate());
+
+    h.game.shooter.hasBow = true;
+    h.game.multishotPerk = false;
+    CHECK_FALSE(h.multishot.TryActivate());
+
+    h.game.multishotPerk = true;
+    REQUIRE(h.multishot.TryActivate());
+    h.game.ammo = 1;
+    CHECK_FALSE(h.multishot.OnArrowRelease());
+    CHECK(h.game.Reported(Event::MultishotInsufficientAmmo) == 1);
+    CHECK(h.multishot.IsReady());
+}
+
+TEST_CASE("TechniqueLogic/PenetratingChargeFireCooldown")
+{
+    Harness h;
+    h.penetrating.OnBowDrawStart();
+    REQUIRE(h.penetrating.IsCharging());
+
+    // Draw events keep arriving while the bow stays drawn
+    for (int i = 0; i < 5; ++i) {
+        h.game.Advance(0.6);
+        h.penetrating.OnBowDrawStart();
+        h.penetrating.Update();
+    }
+    CHECK(h.penetrating.IsCharged());
+
+    h.penetrating.OnArrowRelease();
+    CHECK(h.game.penetratingShots == 1);
+    CHECK(h.penetrating.IsOnCooldown());
+
+    h.game.Advance(h.penetratingConfig.cooldownDuration);
+    h.penetrating.Update();
+    CHECK(h.penetrating.GetState() == PenetratingArrowState::Inactive);
+}
+
+TEST_CASE("TechniqueLogic/PenetratingResets")
+{
+    Harness h;
+
+    SECTION("Draw events stop")
+    {
+        h.penetrating.OnBowDrawStart();
+        h.game.Advance(2.5);
+        h.penetrating.Update();
+        CHECK(h.penetrating.GetState() == PenetratingArrowState::Inactive);
+        CHECK(h.game.Reported(Event::PenetratingDrawLost) == 1);
+    }
+
+    SECTION("Multishot takes over")
+    {
+        h.penetrating.OnBowDrawStart();
+        REQUIRE(h.multishot.TryActivate());
+        h.penetrating.Update();
+        CHECK(h.penetrating.GetState() == PenetratingArrowState::Inactive);
+        h.penetrating.OnBowDrawStart();
+        CHECK_FALSE(h.penetrating.IsCharging());
+    }
+
+    SECTION("Paused skips the draw checks")
+    {
+        h.penetrating.OnBowDrawStart();
+        h.game.shooter.paused = true;
+        h.game.Advance(2.5);
+        h.penetrating.Update();
+        CHECK(h.penetrating.IsCharging());
+    }
+}
+
+TEST_CASE("TechniqueLogic/TrackedDrawChargesByStrength")
+{
+    Harness h;
+    h.game.drawTracked = true;
+    h.game.drawing = true;
+
+    // A held draw is picked up on the next update
+    h.penetrating.Update();
+    REQUIRE(h.penetrating.IsCharging());
+
+    // Half strength takes twice the charge time
+    for (int i = 0; i < 90; ++i) {
+        h.penetrating.OnDrawFrame(0.5f, 1.0f / 30.0f);
+        h.penetrating.Update();
+    }
+    CHECK(h.penetrating.GetChargingProgress() == Catch::Approx(0.5f).margin(0.01f));
+    for (int i = 0; i < 91; ++i) {
+        h.penetrating.OnDrawFrame(0.5f, 1.0f / 30.0f);
+        h.penetrating.Update();
+    }
+    CHECK(h.penetrating.IsCharged());
+}
+
+TEST_CASE("TechniqueLogic/SaveAndLoad")
+{
+    Harness h;
+    REQUIRE(h.multishot.TryActivate());
+    h.game.Advance(2.0);
+
+    TechniqueRecord::Record record;
+    h.multishot.Save(record);
+    REQUIRE(record.count == 1);
+    CHECK(record.entries[0].actor == h.game.playerID);
+    CHECK(record.entries[0].remaining == Catch::Approx(3.0f));
+
+    Harness loaded;
+    loaded.game.now = 500.0;
+    loaded.multishot.Load(record.entries[0]);
+    CHECK(loaded.multishot.IsReady());
+    CHECK(loaded.multishot.GetRemainingReadyTime() == Catch::Approx(3.0f));
+
+    // Charging is never saved
+    h.penetrating.OnBowDrawStart();
+    TechniqueRecord::Record penetrating;
+    h.penetrating.Save(penetrating);
+    CHECK(penetrating.count == 0);
+}
+
+TEST_CASE("TechniqueLogic/LoadClampsToTheConfiguredDuration")
+{
+    // Saved under a longer INI cooldown than the one now in effect
+    TechniqueRecord::Entry entry;
+    entry.state = static_cast<std::uint8_t>(PenetratingArrowState::Cooldown);
+    entry.remaining = 1000.0f;
+
+    Harness h;
+    h.penetrating.Load(entry);
+    CHECK(h.penetrating.IsOnCooldown());
+    CHECK(h.game.Reported(Event::PenetratingRestored) == 1);
+    CHECK(h.game.lastReportValue == Catch::Approx(h.penetratingConfig.cooldownDuration));
+
+    entry.state = static_cast<std::uint8_t>(MultishotState::Ready);
+    h.multishot.Load(entry);
+    CHECK(h.game.Reported(Event::MultishotRestored) == 1);
+    CHECK(h.game.lastReportValue == Catch::Approx(h.multishotConfig.readyWindowDuration));
+    CHECK(h.multishot.GetRemainingReadyTime() == Catch::Approx(h.multishotConfig.readyWindowDuration));
+}
+
+TEST_CASE("TechniqueLogic/VolleyLayout")
+{
+    MultishotConfig config;
+    config.arrowCount = 5;
+    config.spreadAngle = 10.0f;
+
+    Volley::Input input;
+    input.cameraRight[0] = 1.0f;
+    input.cameraUp[2] = 1.0f;
+    input.arrowCount = config.arrowCount;
+
+    auto layout = Volley::Compute(input, config);
+    REQUIRE(layout.count == 4);
+    CHECK(layout.slots[0] == 1);
+
+    // Fan arrows sit on either side of the aim with origins spread along the camera's right
+    for (int n = 0; n < layout.count; ++n) {
+        CHECK(layout.pitch[n] == Catch::Approx(0.0f).margin(1.0e-5f));
+        CHECK(std::abs(layout.yaw[n]) > 0.0f);
+        CHECK(std::abs(layout.origins[n][0]) == Catch::Approx(Volley::kOriginSpacing * std::ceil((layout.slots[n]) / 2.0f)));
+    }
+
+    // Convergence without a projectile keeps the spread angles
+    config.convergence = true;
+    auto skipped = Volley::Compute(input, config);
+    CHECK(skipped.convergenceSkipped);
+    CHECK(skipped.yaw == layout.yaw);
+
+    input.projectileSpeed = 6000.0f;
+    input.projectileGravity = 686.6f;
+    auto converged = Volley::Compute(input, config);
+    CHECK_FALSE(converged.convergenceSkipped);
+    CHECK(converged.unreachable == 0);
+    CHECK(converged.pitch[0] < 0.0f); // aims up to make up for the drop
+}
+
+TEST_CASE("TechniqueLogic/Benchmark", "[!benchmark]")
+{
+    // One scripted session per run: key press, draw, release and the frame updates between them
+    constexpr int kEvents = 1000000;
+
+    BENCHMARK("Scripted events x" + std::to_string(kEvents))
+    {
+        Harness h;
+        h.game.ammo = kEvents;
+        int fired = 0;
+        for (int i = 0; i < kEvents; ++i) {
+            h.game.Advance(0.011);
+            switch (i % 8) {
+            case 0:
+                h.multishot.TryActivate();
+                break;
+            case 3:
+                fired += h.multishot.OnArrowRelease() ? 1 : 0;
+                break;
+            case 4:
+                h.penetrating.OnBowDrawStart();
+                break;
+            case 6:
+                h.penetrating.OnArrowRelease();
+                break;
+            default:
+                h.multishot.Update();
+                h.penetrating.Update();
+                break;
+            }
+        }
+        return fired + h.game.penetratingShots;
+    };
+
+    BENCHMARK("Volley layout with convergence")
+    {
+        MockGame game;
+        game.computeVolleys = true;
+        game.volleyConfig.arrowCount = SpreadPatterns::kMaxArrows;
+        game.volleyConfig.convergence = true;
+        game.LaunchVolley(SpreadPatterns::kMaxArrows, SpreadPatterns::kMaxArrows - 1);
+        return game.lastVolley.count;
+    };
+}
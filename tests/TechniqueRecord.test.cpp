@@ -0,0 +1,65 @@
+#include "catch2/catch_all.hpp"
+
+#include "TechniqueRecord.h"
+#include <cstring>
+#include <limits>
+#include <vector>
+
+TEST_CASE("TechniqueRecord/ByteSizeCoversUsedEntries")
+{
+    TechniqueRecord::Record record;
+    CHECK(record.ByteSize() == 4);
+
+    CHECK(record.Add({ 0x14, 2, {}, 4.5f }));
+    CHECK(record.Add({ 0x12345, 1, {}, 9.0f }));
+    CHECK(record.ByteSize() == 4 + 2 * sizeof(TechniqueRecord::Entry));
+}
+
+TEST_CASE("TechniqueRecord/AddStopsAtCapacity")
+{
+    TechniqueRecord::Record record;
+    for (std::size_t i = 0; i < TechniqueRecord::kMaxEntries; ++i) {
+        REQUIRE(record.Add({ static_cast<std::uint32_t>(i), 0, {}, 0.0f }));
+    }
+    CHECK_FALSE(record.Add({ 0xFFFF, 0, {}, 0.0f }));
+    CHECK(record.count == TechniqueRecord::kMaxEntries);
+}
+
+TEST_CASE("TechniqueRecord/RoundTripThroughBytes")
+{
+    TechniqueRecord::Record saved;
+    saved.Add({ 0x14, 2, {}, 7.25f });
+    saved.Add({ 0xABCDE, 1, {}, 0.5f });
+
+    // What WriteRecord stores: the first ByteSize() bytes of the record
+    std::vector<std::byte> bytes(saved.ByteSize());
+    std::memcpy(bytes.data(), &saved, bytes.size());
+
+    TechniqueRecord::Record loaded;
+    std::memcpy(&loaded.count, bytes.data(), sizeof(loaded.count));
+    auto count = TechniqueRecord::ReadableCount(loaded.count, static_cast<std::uint32_t>(bytes.size()));
+    REQUIRE(count == 2);
+    std::memcpy(loaded.entries.data(), bytes.data() + sizeof(loaded.count), count * sizeof(TechniqueRecord::Entry));
+
+    CHECK(loaded.entries[0].actor == 0x14);
+    CHECK(loaded.entries[0].state == 2);
+    CHECK(loaded.entries[0].remaining == 7.25f);
+    CHECK(loaded.entries[1].actor == 0xABCDE);
+}
+
+TEST_CASE("TechniqueRecord/ReadableCountIsBounded")
+{
+    // Truncated record: count claims more entries than the bytes hold
+    CHECK(TechniqueRecord::ReadableCount(10, 4 + 3 * sizeof(TechniqueRecord::Entry)) == 3);
+    // Oversized table from a larger build is capped
+    CHECK(TechniqueRecord::ReadableCount(100000, 0xFFFFFFFF) == TechniqueRecord::kMaxEntries);
+    CHECK(TechniqueRecord::ReadableCount(5, 2) == 0);
+}
+
+TEST_CASE("TechniqueRecord/ClampRemaining")
+{
+    CHECK(TechniqueRecord::ClampRemaining(5.0f, 10.0f) == 5.0f);
+    CHECK(TechniqueRecord::ClampRemaining(30.0f, 10.0f) == 10.0f);
+    CHECK(TechniqueRecord::ClampRemaining(-1.0f, 10.0f) == 0.0f);
+    CHECK(TechniqueRecord::ClampRemaining(std::numeric_limits<float>::quiet_NaN(), 10.0f) == 0.0f);
+}
@@ -0,0 +1,116 @@
+#include "catch2/catch_all.hpp"
+
+#include "Trace.h"
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+namespace {
+    std::string ExportToString(long long& count)
+    {
+        auto path = std::filesystem::temp_directory_path() / "ArcheryTechniques.test.trace.json";
+        count = Trace::Export(path);
+        std::ifstream file(path);
+        std::stringstream text;
+        text << file.rdbuf();
+        file.close();
+        std::filesystem::remove(path);
+        return text.str();
+    }
+
+    std::size_t Occurrences(const std::string& text, const std::string& needle)
+    {
+        std::size_t count = 0;
+        for (auto at = text.find(needle); at != std::string::npos; at = text.find(needle, at + 1)) {
+            ++count;
+        }
+        return count;
+    }
+}
+
+TEST_CASE("Trace/DisabledRecordsNothing")
+{
+    Trace::SetEnabled(false);
+    Trace::Clear();
+    {
+        Trace::Zone zone("Disabled zone");
+        Trace::Instant("Disabled marker");
+    }
+
+    long long count = 0;
+    auto json = ExportToString(count);
+    CHECK(count == 0);
+    CHECK(json.find("Disabled") == std::string::npos);
+}
+
+TEST_CASE("Trace/ZonesExportAsTraceEvents")
+{
+    Trace::Clear();
+    Trace::SetEnabled(true);
+    Trace::SetThreadName("Test \"main\"");
+    {
+        Trace::Zone outer("Outer");
+        Trace::Instant("Frame");
+        Trace::Zone inner("Inner");
+    }
+    std::thread worker([] {
+        Trace::Zone zone("Worker");
+    });
+    worker.join();
+    Trace::SetEnabled(false);
+
+    long long count = 0;
+    auto json = ExportToString(count);
+    CHECK(count == 4);
+    CHECK(json.rfind("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", 0) == 0);
+    CHECK(json.find("{\"name\":\"Outer\",\"ph\":\"X\"") != std::string::npos);
+    CHECK(json.find("{\"name\":\"Inner\",\"ph\":\"X\"") != std::string::npos);
+    CHECK(json.find("{\"name\":\"Frame\",\"ph\":\"i\"") != std::string::npos);
+    CHECK(json.find("{\"name\":\"Worker\",\"ph\":\"X\"") != std::string::npos);
+    CHECK(json.find("\"args\":{\"name\":\"Test \\\"main\\\"\"}") != std::string::npos);
+
+    // Events come out in start order: Outer opened before the marker and Inner
+    CHECK(json.find("\"Outer\"") < json.find("\"Frame\""));
+    CHECK(json.find("\"Frame\"") < json.find("\"Inner\""));
+    CHECK(json.substr(json.size() - 4) == "\n]}\n");
+}
+
+TEST_CASE("Trace/RingKeepsNewestEvents")
+{
+    Trace::Clear();
+    Trace::SetEnabled(true);
+    for (std::size_t i = 0; i < Trace::kBufferEvents + 100; ++i) {
+        Trace::Zone zone(i < 100 ? "Old" : "New");
+    }
+    Trace::SetEnabled(false);
+
+    long long count = 0;
+    auto json = ExportToString(count);
+    CHECK(count == static_cast<long long>(Trace::kBufferEvents));
+    CHECK(Occurrences(json, "\"Old\"") == 0);
+    CHECK(Occurrences(json, "\"New\"") == Trace::kBufferEvents);
+    Trace::Clear();
+}
+
+TEST_CASE("Trace/Benchmark", "[!benchmark]")
+{
+    Trace::Clear();
+
+    Trace::SetEnabled(false);
+    BENCHMARK("Zone disabled")
+    {
+        Trace::Zone zone("Benchmark");
+        return Trace::IsEnabled();
+    };
+
+    Trace::SetEnabled(true);
+    BENCHMARK("Zone enabled")
+    {
+        Trace::Zone zone("Benchmark");
+        return Trace::IsEnabled();
+    };
+    Trace::SetEnabled(false);
+    Trace::Clear();
+}
@@ -0,0 +1,100 @@
+#include "catch2/catch_all.hpp"
+
+#include "MockGame.h"
+#include "TechniqueLogic.h"
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+// Global operator new is replaced for this whole executable, which is why these
+// tests are built apart from ArcheryTechniquesTests. Allocations are only
+// counted while countingAllocations is set.
+namespace {
+    bool countingAllocations = false;
+    std::size_t allocations = 0;
+
+    void* Allocate(std::size_t bytes)
+    {
+        if (countingAllocations) {
+            ++allocations;
+        }
+        if (void* p = std::malloc(bytes ? bytes : 1)) {
+            return p;
+        }
+        throw std::bad_alloc();
+    }
+
+    void* AllocateAligned(std::size_t bytes, std::align_val_t alignment)
+    {
+        if (countingAllocations) {
+            ++allocations;
+        }
+        auto align = static_cast<std::size_t>(alignment);
+        bytes = (bytes + align - 1) / align * align;
+#ifdef _WIN32
+        // The MSVC CRT has no aligned_alloc; its aligned blocks need _aligned_free
+        void* p = _aligned_malloc(bytes ? bytes : align, align);
+#else
+        void* p = std::aligned_alloc(align, bytes ? bytes : align);
+#endif
+        if (!p) {
+            throw std::bad_alloc();
+        }
+        return p;
+    }
+
+    void FreeAligned(void* p)
+    {
+#ifdef _WIN32
+        _aligned_free(p);
+#else
+        std::free(p);
+#endif
+    }
+}
+
+void* operator new(std::size_t bytes) { return Allocate(bytes); }
+void* operator new[](std::size_t bytes) { return Allocate(bytes); }
+void* operator new(std::size_t bytes, std::align_val_t alignment) { return AllocateAligned(bytes, alignment); }
+void* operator new[](std::size_t bytes, std::align_val_t alignment) { return AllocateAligned(bytes, alignment); }
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+void operator delete(void* p, std::align_val_t) noexcept { FreeAligned(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { FreeAligned(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { FreeAligned(p); }
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept { FreeAligned(p); }
+
+TEST_CASE("VolleyAllocations/CounterSeesTheHeap")
+{
+    allocations = 0;
+    countingAllocations = true;
+    delete new int(1);
+    countingAllocations = false;
+    CHECK(allocations == 1);
+}
+
+TEST_CASE("VolleyAllocations/OneVolleyAllocatesNothing")
+{
+    MockGame game;
+    game.computeVolleys = true;
+    MultishotConfig config;
+    config.arrowCount = SpreadPatterns::kMaxArrows;
+    config.convergence = true;
+    game.volleyConfig = config;
+    MultishotLogic multishot{ game, config };
+    REQUIRE(multishot.TryActivate());
+
+    // The release path the plugin runs: state change, ammo check, then the
+    // volley laid out and launched by Volley::Fire
+    allocations = 0;
+    countingAllocations = true;
+    bool fired = multishot.OnArrowRelease();
+    countingAllocations = false;
+
+    CHECK(fired);
+    CHECK(game.arrowsLaunched == SpreadPatterns::kMaxArrows - 1);
+    CHECK(game.lastVolley.count == SpreadPatterns::kMaxArrows - 1);
+    CHECK(allocations == 0);
+}